@@ -52,6 +52,7 @@ public:
   virtual void solve_and_update();
 
   void initial_work();
+  void pre_timestep_work() final;
   virtual void post_external_data_transfer_work();
   virtual void post_iter_work();
 
@@ -73,6 +74,8 @@ public:
   ScalarFieldType* dplus_;
 
   bool isInit_;
+  // D+ was omitted from a compact restart and is rebuilt before the first step
+  bool recomputeDplus_{false};
 
   // saved of mesh parts that are for wall bcs
   std::vector<stk::mesh::Part*> wallBcPart_;
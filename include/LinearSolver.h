@@ -271,7 +271,19 @@ public:
     return (config_->useSegregatedSolver() ? PT_TPETRA_SEGREGATED : PT_TPETRA);
   }
 
+  /** Operator applied by the Krylov solver in place of the assembled matrix;
+   *  the preconditioner is then built from preconditionerMatrix when given
+   */
+  void set_krylov_operator(
+    Teuchos::RCP<LinSys::Operator> op,
+    Teuchos::RCP<LinSys::Matrix> preconditionerMatrix = Teuchos::null);
+
+  //! Preconditioner setup is skipped when the matrix was not reassembled
+  void set_matrix_updated(bool updated) { matrixUpdated_ = updated; }
+
 private:
+  void create_ifpack2_preconditioner();
+
   //! The solver parameters
   const Teuchos::RCP<Teuchos::ParameterList> params_;
 
@@ -284,8 +296,10 @@ private:
   Teuchos::RCP<LinSys::Preconditioner> preconditioner_;
   Teuchos::RCP<MueLu::TpetraOperator<SC, LO, GO, NO>> mueluPreconditioner_;
   Teuchos::RCP<LinSys::MultiVector> coords_;
+  Teuchos::RCP<LinSys::Operator> krylovOperator_;
 
   std::string preconditionerType_;
+  bool matrixUpdated_{true};
 };
 #endif // NALU_USES_TRILINOS_SOLVERS
 
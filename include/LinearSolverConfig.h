@@ -110,10 +110,19 @@ public:
   std::string& muelu_xml_file() { return muelu_xml_file_; }
   bool use_MueLu() const { return useMueLu_; }
 
+  /** Apply the operator matrix-free in the Krylov iterations, where the
+   *  equation system provides one; the assembled matrix is then only
+   *  refreshed every matrix_refresh_frequency solves for the preconditioner
+   */
+  bool use_matrix_free_operator() const { return useMatrixFreeOperator_; }
+  int matrix_refresh_frequency() const { return matrixRefreshFrequency_; }
+
 private:
   std::string muelu_xml_file_;
   bool summarizeMueluTimer_{false};
   bool useMueLu_{false};
+  bool useMatrixFreeOperator_{false};
+  int matrixRefreshFrequency_{10};
 };
 
 /** User configuration parmeters for Hypre solvers and preconditioners
@@ -298,6 +298,9 @@ public:
 
   virtual void create_constraint_algorithm(stk::mesh::FieldBase*) override;
 
+  //! Krylov operator of the edge Laplacian, when requested by the solver
+  void setup_matrix_free_operator();
+
   const bool elementContinuityEqs_;
   const bool managePNG_;
   ScalarFieldType* pressure_;
@@ -135,7 +135,7 @@ private:
 
   std::ostream& log();
   void validate_matrix_free_linear_solver_config();
-  void check_solver_configuration(std::string, std::string);
+  void check_solver_configuration(std::string, std::vector<std::string>);
   void copy_pressure_grad();
   void compute_provisional_velocity(Kokkos::Array<double, 3> gammas);
   void correct_velocity(double proj_time_scale);
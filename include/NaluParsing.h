@@ -192,9 +192,8 @@ struct OversetUserData : public UserData
   /// List of part names for the interior meshes
   std::vector<std::string> oversetBlockVec_;
 
-#ifdef NALU_USES_TIOGA
+  /// Mesh groups and options of the overset connectivity
   YAML::Node oversetBlocks_;
-#endif
 
   OversetUserData()
     : UserData(),
@@ -261,13 +260,15 @@ struct NonConformalUserData : public UserData
   bool clipIsoParametricCoords_;
   double searchTolerance_;
   bool dynamicSearchTolAlg_;
+  bool predictiveSearch_;
   NonConformalUserData()
     : UserData(),
       searchMethodName_("na"),
       expandBoxPercentage_(0.0),
       clipIsoParametricCoords_(false),
       searchTolerance_(1.0e-16),
-      dynamicSearchTolAlg_(false)
+      dynamicSearchTolAlg_(false),
+      predictiveSearch_(false)
   {
   }
 };
@@ -293,8 +294,9 @@ struct OpenBoundaryConditionData : public BoundaryCondition
 struct OversetBoundaryConditionData : public BoundaryCondition
 {
   enum OversetAPI {
-    TPL_TIOGA = 0,   ///< Overset connectivity using TIOGA
-    OVERSET_NONE = 1 ///< Guard for error messages
+    TPL_TIOGA = 0,    ///< Overset connectivity using TIOGA
+    NATIVE_STK = 1,   ///< Overset connectivity computed on the STK mesh
+    OVERSET_NONE = 2  ///< Guard for error messages
   };
 
   OversetBoundaryConditionData() {};
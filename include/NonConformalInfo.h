@@ -19,6 +19,7 @@
 // stk
 #include <stk_mesh/base/Part.hpp>
 #include <stk_mesh/base/Ghosting.hpp>
+#include <stk_mesh/base/Types.hpp>
 
 #include <stk_search/BoundingBox.hpp>
 #include <stk_search/IdentProc.hpp>
@@ -73,7 +74,8 @@ public:
     const bool clipIsoParametricCoords,
     const double searchTolerance,
     const bool dynamicSearchTolAlg,
-    const std::string debugName);
+    const std::string debugName,
+    const bool predictiveSearch = false);
 
   ~NonConformalInfo();
 
@@ -89,6 +91,7 @@ public:
   void reset_dgInfo();
   void construct_bounding_points();
   void construct_bounding_boxes();
+  void predict_opposing_faces();
   void determine_elems_to_ghost();
   void complete_search();
   void provide_diagnosis();
@@ -132,7 +135,28 @@ public:
   /* save off product of search */
   std::vector<std::pair<theKey, theKey>> searchKeyPair_;
 
+  /* test the last best opposing faces and their neighbors before searching;
+   * only the points they do not contain enter the coarse search */
+  const bool predictiveSearch_;
+
+  /* best opposing face id of the last search, by local gauss point id */
+  std::vector<stk::mesh::EntityId> previousOpposingFaceIds_;
+
+  /* gauss points resolved by the prediction, by local gauss point id */
+  std::vector<char> predicted_;
+
+  /* received ghosts used by predicted points, with their owning rank */
+  stk::mesh::EntityProcVec ghostsToKeep_;
+
 private:
+  /* fine search of one candidate opposing face; keeps it if it is the best
+   * so far */
+  void evaluate_opposing_face(
+    DgInfo* dgInfo,
+    stk::mesh::Entity opposingFace,
+    const double nearestDistanceSaved,
+    double& nearestDistance);
+
   void delete_range_points_found(
     std::vector<boundingSphere>& boundingSphereVec,
     const std::vector<std::pair<theKey, theKey>>& searchKeyPair) const;
@@ -10,6 +10,7 @@
 #ifndef OutputInfo_h
 #define OutputInfo_h
 
+#include <map>
 #include <string>
 #include <set>
 
@@ -41,6 +42,10 @@ public:
   int get_restart_compression();
   bool get_restart_shuffle();
 
+  // compact restart: recomputed fields are neither written nor read
+  bool omit_restart_field(const std::string& fieldName) const;
+  bool skip_restart_read(const std::string& fieldName) const;
+
   std::string outputDBName_;
 
   // catalyst options
@@ -66,6 +71,8 @@ public:
   bool outputCompressionShuffle_;
   int restartCompressionLevel_;
   bool restartCompressionShuffle_;
+  bool restartCompact_;
+  bool restartReportReadTimings_;
 
   std::pair<bool, double> userWallTimeResults_;
   std::pair<bool, double> userWallTimeRestart_;
@@ -75,7 +82,11 @@ public:
   Ioss::PropertyManager* restartPropertyManager_;
 
   std::set<std::string> outputFieldNameSet_;
+  // absolute error bounds of the output fields written with lossy compression
+  std::map<std::string, double> outputLossyToleranceMap_;
   std::set<std::string> restartFieldNameSet_;
+  std::set<std::string> restartRecomputedFieldNameSet_;
+  std::set<std::string> restartSkipFieldNameSet_;
 };
 
 } // namespace nalu
@@ -39,6 +39,18 @@ typedef stk::search::Point<double> Point;
 typedef stk::search::Sphere<double> Sphere;
 typedef std::pair<Sphere, theEntityKey> sphereBoundingBox;
 
+//! Nodal field and number of components for a batched periodic update
+struct PeriodicFieldData
+{
+  PeriodicFieldData(stk::mesh::FieldBase* field, const unsigned sizeOfField)
+    : field_(field), sizeOfField_(sizeOfField)
+  {
+  }
+
+  stk::mesh::FieldBase* field_;
+  unsigned sizeOfField_;
+};
+
 class PeriodicManager
 {
 
@@ -74,6 +86,22 @@ public:
     const bool& setSlaves = true,
     const bool& doCommunication = true) const;
 
+  // batched variants; one ghosting/parallel communication for all the fields.
+  // apply_constraints works on the host copies, syncing them from device
+  // first, and leaves the fields modified on host
+  void apply_constraints(
+    const std::vector<PeriodicFieldData>& fields,
+    const bool& bypassFieldCheck,
+    const bool& addSlaves = true,
+    const bool& setSlaves = true);
+
+  void ngp_apply_constraints(
+    const std::vector<PeriodicFieldData>& fields,
+    const bool& bypassFieldCheck,
+    const bool& addSlaves = true,
+    const bool& setSlaves = true,
+    const bool& doCommunication = true) const;
+
   // find the max
   void apply_max_field(stk::mesh::FieldBase*, const unsigned& sizeOfField);
 
@@ -125,6 +153,19 @@ public:
 
   void ngp_parallel_communicate_field(stk::mesh::FieldBase* theField) const;
 
+  /* batched communication of double fields */
+  void periodic_parallel_communicate_fields(
+    const std::vector<PeriodicFieldData>& fields) const;
+
+  void ngp_periodic_parallel_communicate_fields(
+    const std::vector<PeriodicFieldData>& fields) const;
+
+  void parallel_communicate_fields(
+    const std::vector<PeriodicFieldData>& fields) const;
+
+  void ngp_parallel_communicate_fields(
+    const std::vector<PeriodicFieldData>& fields) const;
+
   Realm& realm_;
 
   /* manage tolerances; each block specifies a user tolerance */
@@ -147,6 +188,10 @@ public:
   typedef std::vector<std::pair<theEntityKey, theEntityKey>> SearchKeyVector;
   typedef Kokkos::View<KokkosEntityPair*, Kokkos::LayoutRight, MemSpace>
     KokkosEntityPairView;
+  typedef Kokkos::View<stk::mesh::Entity*, Kokkos::LayoutRight, MemSpace>
+    KokkosEntityView;
+  typedef Kokkos::View<unsigned*, Kokkos::LayoutRight, MemSpace>
+    KokkosOffsetView;
 
   std::vector<int> ghostCommProcs_;
 
@@ -180,21 +225,35 @@ private:
 
   // vector of masterEntity:slaveEntity
   std::vector<EntityPair> masterSlaveCommunicator_;
-  KokkosEntityPairView deviceMasterSlaves_;
-  KokkosEntityPairView::HostMirror hostMasterSlaves_;
+
+  // flat master->slaves map grouped by master node; the slaves of masters(i)
+  // are slaves(slaveOffsets(i)) ... slaves(slaveOffsets(i+1) - 1). Each
+  // master is updated by a single thread, so no atomics are needed
+  KokkosEntityView deviceMasters_;
+  KokkosEntityView deviceSlaves_;
+  KokkosOffsetView deviceSlaveOffsets_;
+  KokkosEntityView::HostMirror hostMasters_;
+  KokkosEntityView::HostMirror hostSlaves_;
+  KokkosOffsetView::HostMirror hostSlaveOffsets_;
+
+  void build_master_slave_map();
 
   // culmination of all searches
   SearchKeyVector searchKeyVector_;
 
-  void add_slave_to_master(
-    stk::mesh::FieldBase* theField,
-    const unsigned& sizeOfField,
-    const bool& bypassFieldCheck);
+  // kernels over the master->slaves map for one field; mode is one of
+  // ADD (master += slaves), SET (slaves = master) or ADD_SET (both, fused)
+  enum ConstraintMode { ADD = 1, SET = 2, ADD_SET = 3 };
 
-  void set_slave_to_master(
-    stk::mesh::FieldBase* theField,
-    const unsigned& sizeOfField,
-    const bool& bypassFieldCheck);
+  void host_constraint_kernel(
+    const PeriodicFieldData& fieldData,
+    const bool bypassFieldCheck,
+    const ConstraintMode mode) const;
+
+  void device_constraint_kernel(
+    const PeriodicFieldData& fieldData,
+    const bool bypassFieldCheck,
+    const ConstraintMode mode) const;
 };
 
 } // namespace nalu
@@ -64,10 +64,12 @@ class NonConformalManager;
 class ErrorIndicatorAlgorithmDriver;
 class EquationSystems;
 class FieldManager;
+class HaloExchange;
 class OutputInfo;
 class OversetManager;
 class PostProcessingInfo;
 class PeriodicManager;
+struct PeriodicFieldData;
 class Realms;
 class Simulation;
 class SolutionOptions;
@@ -86,6 +88,7 @@ class LidarLOS;
 class AeroContainer;
 class ABLForcingAlgorithm;
 class BdyLayerStatistics;
+class ABLSpectra;
 
 class TensorProductQuadratureRule;
 class LagrangeBasis;
@@ -155,7 +158,8 @@ public:
 
   void augment_output_variable_list(const std::string fieldName);
 
-  void augment_restart_variable_list(std::string restartFieldName);
+  void augment_restart_variable_list(
+    std::string restartFieldName, bool recomputedOnRestart = false);
 
   void create_edges();
   void provide_entity_count();
@@ -168,6 +172,8 @@ public:
   bool has_mesh_motion() const;
   bool has_mesh_deformation() const;
   bool does_mesh_move() const;
+  //! Changes whenever the coordinates may have moved
+  std::size_t coordinates_version() const;
   bool has_non_matching_boundary_face_alg() const;
 
   // overset boundary condition requires elemental field registration
@@ -184,6 +190,8 @@ public:
   void compute_l2_scaling();
   void output_converged_results();
   void provide_output(bool forcedOutput = false);
+  //! Write out output buffered across steps; called at the end of the run
+  void flush_output();
   void provide_restart_output();
 
   void register_interior_algorithm(stk::mesh::Part* part);
@@ -227,6 +235,11 @@ public:
     const unsigned& sizeOfTheField,
     const bool& bypassFieldCheck = true) const;
 
+  //! Batched periodic_field_update with one communication for all fields
+  void periodic_field_update(
+    const std::vector<PeriodicFieldData>& fields,
+    const bool& bypassFieldCheck = true) const;
+
   void periodic_field_max(
     stk::mesh::FieldBase* theField, const unsigned& sizeOfTheField) const;
 
@@ -240,6 +253,9 @@ public:
 
   const stk::mesh::PartVector& get_slave_part_vector();
 
+  //! Aggregated parallel field updates, created on first use
+  HaloExchange& halo_exchange();
+
   void overset_field_update(
     stk::mesh::FieldBase* field,
     const unsigned nRows,
@@ -255,6 +271,7 @@ public:
   {
   }
   virtual double populate_restart(double& timeStepNm1, int& timeStepCount);
+  double read_restart_fields_with_timings(const double restartTime);
   virtual void populate_derived_quantities();
   virtual void evaluate_properties();
   virtual double compute_adaptive_time_step();
@@ -394,6 +411,9 @@ public:
   size_t resultsFileIndex_;
   size_t restartFileIndex_;
 
+  // restart fields read one at a time so that their read time is reported
+  std::vector<std::string> restartTimedFieldNames_;
+
   // nalu field data
   GlobalIdFieldType* naluGlobalId_;
 
@@ -424,10 +444,14 @@ public:
   std::unique_ptr<AeroContainer> aeroModels_;
   ABLForcingAlgorithm* ablForcingAlg_;
   BdyLayerStatistics* bdyLayerStats_{nullptr};
+#ifdef NALU_USES_FFTW
+  std::unique_ptr<ABLSpectra> ablSpectra_;
+#endif
   std::unique_ptr<FieldManager> fieldManager_;
   std::unique_ptr<MeshMotionAlg> meshMotionAlg_;
   std::unique_ptr<MeshTransformationAlg> meshTransformationAlg_;
   std::unique_ptr<LidarLOS> lidarLOS_;
+  std::unique_ptr<HaloExchange> haloExchange_;
 
   std::vector<Algorithm*> propertyAlg_;
   std::map<PropertyIdentifier, ScalarFieldType*> propertyMap_;
@@ -523,6 +547,10 @@ public:
   // mesh parts for all interior domains
   stk::mesh::PartVector interiorPartVec_;
 
+  // compute geometry and GCL fields of deforming hex parts in one pass
+  bool fusedMeshMotionGeometry_{false};
+  stk::mesh::PartVector fusedGeometryPartVec_;
+
   /** Vector holding side sets that have been registered with the boundary
    * conditions in the input file.
    *
@@ -584,6 +612,7 @@ public:
   // element promotion options
   bool doPromotion_; // conto
   unsigned promotionOrder_;
+  bool threadedPromotion_;
 
   // id for the input mesh
   size_t inputMeshIdx_;
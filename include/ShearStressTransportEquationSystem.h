@@ -53,6 +53,7 @@ public:
   virtual void solve_and_update();
 
   void initial_work();
+  void pre_timestep_work() final;
   virtual void post_external_data_transfer_work();
   void post_iter_work() final;
   void pre_iter_work() final;
@@ -83,6 +84,8 @@ public:
   ScalarFieldType* maxLengthScale_;
 
   bool isInit_;
+  // f1 was omitted from a compact restart and is rebuilt before the first step
+  bool recomputeFOneBlending_{false};
   AlgorithmDriver* sstMaxLengthScaleAlgDriver_;
 
   // saved of mesh parts that are for wall bcs
@@ -10,6 +10,8 @@
 #ifndef SIDEWRITER_H
 #define SIDEWRITER_H
 
+#include <map>
+#include <cstdint>
 #include <set>
 #include <vector>
 #include <string>
@@ -34,22 +36,158 @@ class Part;
 namespace sierra {
 namespace nalu {
 
-class SideWriter
+//! Storage options of a side output database
+struct SideWriterOutputOptions
+{
+  //! Deflate level of the netcdf4 file; 0 disables compression
+  int compressionLevel{0};
+  //! Store floating point data as float32
+  bool singlePrecision{false};
+  //! Absolute error bounds of the fields quantized before compression
+  std::map<std::string, double> lossyTolerances;
+};
+
+//! Common interface of the sideset writers held by SideWriterContainer
+class SideWriterBase
+{
+public:
+  virtual ~SideWriterBase() = default;
+
+  //! Record the side data at this time; written out once the buffer is full
+  virtual void write_database_data(double time) = 0;
+
+  //! Write out any buffered steps
+  virtual void flush() = 0;
+};
+
+//! Writes the full-resolution side data to an Exodus database
+class SideWriter : public SideWriterBase
 {
 public:
   SideWriter(
     const stk::mesh::BulkData& bulk,
     std::vector<const stk::mesh::Part*> sides,
     std::vector<const stk::mesh::FieldBase*> fields,
-    std::string fname);
+    std::string fname,
+    SideWriterOutputOptions options = SideWriterOutputOptions(),
+    int bufferSteps = 1);
+
+  ~SideWriter();
+
+  void write_database_data(double time) override;
 
-  void write_database_data(double time);
+  void flush() override;
 
 private:
   void add_fields(std::vector<const stk::mesh::FieldBase*> fields);
   const stk::mesh::BulkData& bulk_;
   std::unique_ptr<Ioss::Region> output_;
   std::set<const stk::mesh::FieldBase*> fields_;
+  std::map<std::string, double> lossyTolerances_;
+
+  //! Global ids of the nodes in the side node block, in output order
+  std::vector<int64_t> nodeIds_;
+
+  //! Number of output steps collected in memory before each write
+  int bufferSteps_{1};
+
+  //! Buffered times and flattened field data, [step][field]
+  std::vector<double> bufferedTimes_;
+  std::vector<std::vector<std::vector<double>>> bufferedData_;
+};
+
+/** Writes reduced side data to a NetCDF file
+ *
+ *  The faces of the sidesets are agglomerated onto patches obtained by
+ *  binning the face centroids (in model coordinates) onto a Cartesian grid
+ *  with spacing `patchSize`. A non-positive patch size lumps all faces into a
+ *  single patch, which yields the surface-integrated quantities. For every
+ *  patch the area, area vector, centroid and the area-weighted mean of each
+ *  field are written; for scalar fields the integral of the field times the
+ *  area vector (e.g., the pressure force) is written as well.
+ *
+ *  Partial patch sums are gathered on the root rank, which buffers
+ *  `bufferSteps` output steps before writing them in one call. The output
+ *  options set the precision and deflate level of the patch variables and
+ *  quantize the means and forces of the listed fields.
+ */
+class SidePatchWriter : public SideWriterBase
+{
+public:
+  SidePatchWriter(
+    const stk::mesh::BulkData& bulk,
+    std::vector<const stk::mesh::Part*> sides,
+    std::vector<const stk::mesh::FieldBase*> fields,
+    std::string fname,
+    double patchSize,
+    SideWriterOutputOptions options = SideWriterOutputOptions(),
+    int bufferSteps = 1);
+
+  ~SidePatchWriter();
+
+  void write_database_data(double time) override;
+
+  void flush() override;
+
+  //! Number of patches over all ranks (only valid on the root rank)
+  int number_of_patches() const { return numPatches_; }
+
+  //! Patch data of the last output step on the root rank, [patch][value]
+  const std::vector<double>& patch_data() const { return patchData_; }
+
+  //! Offset of a field's area-weighted mean in the per-patch values
+  int field_offset(int ifield) const { return fieldOffsets_[ifield]; }
+
+  //! Offset of the area vector in the per-patch values
+  int area_vector_offset() const { return 1; }
+
+private:
+  //! Assign the locally owned faces to patches and build the global map
+  void build_patches();
+
+  //! Create the NetCDF file and define its variables
+  void prepare_nc_file();
+
+  const stk::mesh::BulkData& bulk_;
+  std::vector<const stk::mesh::Part*> sides_;
+  std::vector<const stk::mesh::FieldBase*> fields_;
+  std::string fileName_;
+  double patchSize_{0.0};
+  SideWriterOutputOptions options_;
+  int nDim_{3};
+
+  //! Local patch index of each locally owned face, in bucket order; rebuilt
+  //! whenever the mesh has been modified since
+  std::vector<int> facePatch_;
+  size_t meshModCount_{0};
+
+  //! Number of local patches on this rank
+  int numLocalPatches_{0};
+
+  //! Number of patches over all ranks
+  int numPatches_{0};
+
+  //! Number of values per patch:
+  //! [area, area vector, centroid, field means, scalar field forces]
+  int numValues_{0};
+  std::vector<int> fieldOffsets_;
+  std::vector<int> forceOffsets_;
+
+  //! Root rank: number of local patches on each rank and the global index
+  //! of each gathered local patch
+  std::vector<int> recvCounts_;
+  std::vector<int> recvDispls_;
+  std::vector<int> gatheredPatch_;
+
+  //! Root rank: global patch data of the last step
+  std::vector<double> patchData_;
+
+  int bufferSteps_{1};
+  std::vector<double> bufferedTimes_;
+  std::vector<double> bufferedData_;
+
+  //! Number of records written to the NetCDF file
+  size_t outputCounter_{0};
 };
 
 class SideWriterContainer
@@ -58,16 +196,23 @@ public:
   void load(const YAML::Node& node);
   void construct_writers(const stk::mesh::BulkData& bulk);
   void write_sides(const int stepCount, const double time);
+  //! Write out the steps still buffered by the writers
+  void flush();
   // use outputFileNames since writers have to be constructed
   // so this can be used before the construction
   inline int number_of_writers() { return outputFileNames_.size(); };
 
 private:
-  std::vector<SideWriter> sideWriters_;
+  std::vector<std::unique_ptr<SideWriterBase>> sideWriters_;
   std::vector<std::string> outputFileNames_;
   std::vector<int> outputFrequency_;
   std::vector<std::vector<std::string>> sideNames_;
   std::vector<std::vector<std::string>> fieldNames_;
+  std::vector<SideWriterOutputOptions> outputOptions_;
+  // full, patches or integrated
+  std::vector<std::string> outputModes_;
+  std::vector<double> patchSizes_;
+  std::vector<int> bufferSteps_;
 };
 } // namespace nalu
 } // namespace sierra
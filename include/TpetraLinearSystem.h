@@ -47,6 +47,27 @@ typedef std::unordered_map<stk::mesh::EntityId, size_t> MyLIDMapType;
 
 typedef std::pair<stk::mesh::Entity, stk::mesh::Entity> Connection;
 
+/** Operator applied by the Krylov solver in place of the assembled matrix
+ *
+ *  The operator applies the LHS of the interior algorithm itself, which then
+ *  only sums into the matrix every few solves. The remaining algorithms
+ *  assemble their LHS on every solve, and the preconditioner is built from a
+ *  copy of the matrix taken when it is complete.
+ */
+class TpetraMatrixFreeOperator : public LinSys::Operator
+{
+public:
+  virtual ~TpetraMatrixFreeOperator() = default;
+
+  /** Called before every solve with the assembled matrix; refreshed is true
+   *  when it also holds the LHS of the interior algorithm
+   */
+  virtual void update(const LinSys::Matrix& matrix, bool refreshed) = 0;
+};
+
+//! Device flag telling the coefficient appliers whether to sum into the LHS
+using LhsAssemblyFlag = Kokkos::View<int, LinSysMemSpace>;
+
 class TpetraLinearSystem : public LinearSystem
 {
 public:
@@ -196,6 +217,21 @@ public:
   }
   LinSys::LocalOrdinal getMaxOwnedRowId() { return maxOwnedRowId_; }
 
+  /** Solve with a matrix-free operator; the interior LHS is then only
+   *  assembled on every refreshFrequency-th assembly
+   */
+  void set_matrix_free_operator(
+    Teuchos::RCP<TpetraMatrixFreeOperator> op, int refreshFrequency);
+
+  //! Whether the interior algorithm has to sum into the LHS
+  bool assembles_interior_lhs() const
+  {
+    return matrixFreeOperator_.is_null() || refreshMatrix_;
+  }
+
+  //! Enable or disable summing into the LHS for the algorithms that follow
+  void set_lhs_assembly(bool assembleLhs);
+
   LinSys::LocalVector getOwnedLocalRhs()
   {
     return ownedRhs_->getLocalViewDevice(Tpetra::Access::ReadWrite);
@@ -218,7 +254,8 @@ public:
       LinSys::EntityToLIDView entityColLIDs,
       int maxOwnedRowId,
       int maxSharedNotOwnedRowId,
-      unsigned numDof)
+      unsigned numDof,
+      LhsAssemblyFlag assembleLhs)
       : ownedLocalMatrix_(ownedLclMatrix),
         sharedNotOwnedLocalMatrix_(sharedNotOwnedLclMatrix),
         ownedLocalRhs_(ownedLclRhs),
@@ -227,7 +264,8 @@ public:
         entityToColLID_(entityColLIDs),
         maxOwnedRowId_(maxOwnedRowId),
         maxSharedNotOwnedRowId_(maxSharedNotOwnedRowId),
-        numDof_(numDof)
+        numDof_(numDof),
+        assembleLhs_(assembleLhs)
     {
     }
 
@@ -264,6 +302,7 @@ public:
     LinSys::EntityToLIDView entityToColLID_;
     int maxOwnedRowId_, maxSharedNotOwnedRowId_;
     unsigned numDof_;
+    LhsAssemblyFlag assembleLhs_;
   };
 
   void buildConnectedNodeGraph(
@@ -344,6 +383,15 @@ public:
                                         // num_sharedNotOwned_nodes) * numDof_
 
   std::vector<int> sortPermutation_;
+
+  Teuchos::RCP<TpetraMatrixFreeOperator> matrixFreeOperator_;
+  //! Copy of the last complete matrix, used to build the preconditioner
+  Teuchos::RCP<LinSys::Matrix> preconditionerMatrix_;
+  int matrixRefreshFrequency_{1};
+  int numAssemblies_{0};
+  bool refreshMatrix_{true};
+  bool assembleLhs_{true};
+  LhsAssemblyFlag assembleLhsDevice_{"assembleLhs"};
 };
 
 template <typename T1, typename T2>
@@ -53,6 +53,21 @@ compute_blade_distributions(const ActuatorMeta& actMeta, ActuatorBulk& actBulk);
  */
 bool blade_belongs_on_this_rank(
   int totalNumBlades, int globBladeNum, int numRanks, int ranks);
+
+/**
+ * @brief Balance the blades over a subset of the ranks
+ *
+ * The cost of a blade is its number of points times the number of nearest
+ * points used by the lifting line correction.  Blades are assigned greedily,
+ * most expensive first, to the least loaded rank.
+ *
+ * @param blades all blades in the simulation
+ * @param ranks the ranks sharing the work
+ * @return std::vector<int> - the rank assigned to each blade
+ */
+std::vector<int> balance_blades_over_ranks(
+  const std::vector<BladeDistributionInfo>& blades,
+  const std::vector<int>& ranks);
 } // namespace nalu
 } // namespace sierra
 
@@ -12,6 +12,7 @@
 
 #include <aero/actuator/ActuatorTypes.h>
 #include <aero/actuator/ActuatorSearch.h>
+#include <aero/actuator/ActuatorInfluence.h>
 #include <Enums.h>
 #include <vector>
 
@@ -52,6 +53,9 @@ struct ActuatorMeta
   ActVectorDblDv epsilon_;
   ActFixScalarBool entityFLLC_;
   ActScalarIntDv numNearestPointsFllcInt_;
+  // ranks sharing the per-blade lifting line correction, empty for the
+  // default assignment; sampling, forces and spreading are not moved
+  std::vector<int> workRanks_;
 };
 
 /*! \brief Where field data is stored and accessed for actuators
@@ -97,6 +101,17 @@ struct ActuatorBulk
   ActFixScalarInt localParallelRedundancy_;
   ActFixElemIds elemContainingPoint_;
 
+  // Element boxes of the search parts, reused until the mesh is modified
+  VecBoundElemBox elemBoxes_;
+  size_t elemBoxesSyncCount_{0};
+  bool elemBoxesCached_{false};
+
+  // The owning elements of the previous search can seed the next one
+  bool hasPreviousSearch_{false};
+
+  // Force spreading stencil of each point, built from the coarse search
+  ActuatorInfluence influence_;
+
   const int localTurbineId_;
 };
 
@@ -14,6 +14,7 @@
 #include <aero/actuator/ActuatorBulk.h>
 #include <FieldTypeDef.h>
 #include <KokkosInterface.h>
+#include <utils/PerfRegions.h>
 
 namespace stk {
 namespace mesh {
@@ -41,6 +42,7 @@ struct InterpActuatorVel
 inline void
 RunInterpActuatorVel(ActuatorBulk& actBulk, stk::mesh::BulkData& stkBulk)
 {
+  PerfRegion region("Actuator::interpolate_velocity");
   Kokkos::deep_copy(actBulk.velocity_.view_host(), 0.0);
   actBulk.velocity_.modify_host();
   Kokkos::parallel_for(
@@ -67,6 +69,35 @@ struct SpreadForceInnerLoop
 using SpreadActuatorForce =
   GenericLoopOverCoarseSearchResults<ActuatorBulk, SpreadForceInnerLoop>;
 
+/*! \brief Isotropic Gaussian force spreading over the cached influence lists
+ *
+ * Equivalent to SpreadActuatorForce, looping over the actuator points
+ * (range `actBulk.influence_.num_points()`).  The Gaussian exponentials of a
+ * point's nodes are evaluated in SIMD batches.
+ */
+struct SpreadActuatorForceInfluence
+{
+  using execution_space = ActuatorFixedExecutionSpace;
+
+  SpreadActuatorForceInfluence(
+    ActuatorBulk& actBulk, stk::mesh::BulkData& stkBulk);
+
+  void operator()(int pointId) const;
+
+  ActuatorBulk& actBulk_;
+  VectorFieldType* actuatorSource_;
+  ScalarFieldType* dualNodalVolume_;
+};
+
+inline void
+RunSpreadActuatorForce(ActuatorBulk& actBulk, stk::mesh::BulkData& stkBulk)
+{
+  PerfRegion region("Actuator::spread_force");
+  Kokkos::parallel_for(
+    "spreadForceInfluence", HostRangePolicy(0, actBulk.influence_.num_points()),
+    SpreadActuatorForceInfluence(actBulk, stkBulk));
+}
+
 } /* namespace nalu */
 } /* namespace sierra */
 
@@ -164,6 +164,10 @@ using ActFastSpreadForceWhProjection = GenericLoopOverCoarseSearchResults<
   ActuatorBulkFAST,
   ActFastSpreadForceWhProjInnerLoop>;
 
+using ActFastSpreadForceWhProjInfluence = GenericLoopOverInfluenceLists<
+  ActuatorBulkFAST,
+  ActFastSpreadForceWhProjInnerLoop>;
+
 } /* namespace nalu */
 } /* namespace sierra */
 
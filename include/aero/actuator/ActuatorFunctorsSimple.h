@@ -138,6 +138,10 @@ using ActSimpleSpreadForceWhProjection = GenericLoopOverCoarseSearchResults<
   ActuatorBulkSimple,
   ActSimpleSpreadForceWhProjInnerLoop>;
 
+using ActSimpleSpreadForceWhProjInfluence = GenericLoopOverInfluenceLists<
+  ActuatorBulkSimple,
+  ActSimpleSpreadForceWhProjInnerLoop>;
+
 } /* namespace nalu */
 } /* namespace sierra */
 
@@ -127,6 +127,55 @@ struct GenericLoopOverCoarseSearchResults
   functor innerLoopFunctor_;
 };
 
+/*! \brief Loop over the cached influence lists of the actuator points
+ *
+ * Drop-in replacement of GenericLoopOverCoarseSearchResults for inner loop
+ * functors that are linear in the subcontrol volume (e.g., force spreading):
+ * the functor is called once per (point, node) pair with the subcontrol
+ * volumes of the point's coarse search elements already summed per node.
+ * The range of the loop is the number of actuator points.
+ */
+template <typename ActuatorBulk, typename functor>
+struct GenericLoopOverInfluenceLists
+{
+  using execution_space = ActuatorFixedExecutionSpace;
+
+  GenericLoopOverInfluenceLists(
+    ActuatorBulk& actBulk, stk::mesh::BulkData& stkBulk)
+    : actBulk_(actBulk),
+      stkBulk_(stkBulk),
+      actuatorSource_(stkBulk_.mesh_meta_data().template get_field<double>(
+        stk::topology::NODE_RANK, "actuator_source")),
+      dualNodalVolume_(stkBulk_.mesh_meta_data().template get_field<double>(
+        stk::topology::NODE_RANK, "dual_nodal_volume")),
+      innerLoopFunctor_(actBulk)
+  {
+    innerLoopFunctor_.preloop();
+  }
+
+  void operator()(int pointId) const
+  {
+    const auto& influence = actBulk_.influence_;
+    const int begin = influence.offsets_[pointId];
+    const int end = influence.offsets_[pointId + 1];
+    for (int k = begin; k < end; ++k) {
+      const stk::mesh::Entity node = influence.nodes_[k];
+      const double nodeCoords[3] = {
+        influence.coordX_[k], influence.coordY_[k], influence.coordZ_[k]};
+      const double dual_vol = *stk::mesh::field_data(*dualNodalVolume_, node);
+      double* sourceTerm = stk::mesh::field_data(*actuatorSource_, node);
+      innerLoopFunctor_(
+        pointId, nodeCoords, sourceTerm, dual_vol, influence.volumes_[k]);
+    }
+  }
+
+  ActuatorBulk& actBulk_;
+  stk::mesh::BulkData& stkBulk_;
+  VectorFieldType* actuatorSource_;
+  ScalarFieldType* dualNodalVolume_;
+  functor innerLoopFunctor_;
+};
+
 } // namespace nalu
 } // namespace sierra
 
@@ -0,0 +1,85 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef ACTUATORINFLUENCE_H_
+#define ACTUATORINFLUENCE_H_
+
+#include <aero/actuator/ActuatorTypes.h>
+#include <stk_mesh/base/Entity.hpp>
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace stk {
+namespace mesh {
+class BulkData;
+} // namespace mesh
+} // namespace stk
+
+namespace sierra {
+namespace nalu {
+
+/*! \brief Cached node influence lists of the actuator points
+ *
+ * CSR list, per actuator point, of the nodes reached by the force spreading,
+ * i.e. the nodes of the coarse search elements of the point.  Each entry holds
+ * the node coordinates and the sum of the subcontrol volumes of those elements
+ * attached to the node.  Spreading over the lists evaluates the Gaussian once
+ * per (point, node) pair instead of once per (point, element, integration
+ * point) and does not recompute the subcontrol volumes every time step.
+ *
+ * The list of a point is only rebuilt when its set of coarse search elements
+ * changes, so rotating blades only pay for the points that crossed into new
+ * elements.  The subcontrol volumes are cached per element and the cached data
+ * assumes the model coordinates do not change until clear() is called.
+ */
+struct ActuatorInfluence
+{
+  void update(
+    stk::mesh::BulkData& stkBulk,
+    ActScalarU64Dv coarsePointIds,
+    ActScalarU64Dv coarseElemIds,
+    int numPoints);
+
+  //! Discard all cached data, required after a mesh modification
+  void clear();
+
+  int num_points() const
+  {
+    return offsets_.empty() ? 0 : static_cast<int>(offsets_.size()) - 1;
+  }
+
+  // influence lists, entries offsets_[p] to offsets_[p+1] belong to point p
+  std::vector<int> offsets_;
+  std::vector<stk::mesh::Entity> nodes_;
+  std::vector<double> coordX_;
+  std::vector<double> coordY_;
+  std::vector<double> coordZ_;
+  std::vector<double> volumes_;
+
+  //! Number of points whose list was rebuilt by the last update
+  int numRebuilt_{0};
+
+private:
+  const std::vector<double>&
+  element_volumes(stk::mesh::BulkData& stkBulk, uint64_t elemId);
+
+  // coarse search elements of each point at the last update, sorted
+  std::vector<int> elemOffsets_;
+  std::vector<uint64_t> elems_;
+
+  // subcontrol volumes summed per element node
+  std::unordered_map<uint64_t, std::vector<double>> elemVolumes_;
+};
+
+} // namespace nalu
+} // namespace sierra
+
+#endif // ACTUATORINFLUENCE_H_
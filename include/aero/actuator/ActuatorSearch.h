@@ -12,6 +12,8 @@
 
 #include <aero/actuator/ActuatorTypes.h>
 #include <stk_mesh/base/BulkData.hpp>
+#include <stk_mesh/base/MetaData.hpp>
+#include <stk_mesh/base/Selector.hpp>
 #include <Kokkos_Core.hpp>
 #include <stk_search/BoundingBox.hpp>
 #include <stk_search/IdentProc.hpp>
@@ -32,6 +34,11 @@ using VecSearchKeyPair = std::vector<SearchKeyPair>;
 namespace sierra {
 namespace nalu {
 
+//! Locally owned elements of the actuator search target parts
+stk::mesh::Selector ActuatorSearchSelector(
+  const stk::mesh::MetaData& stkMeta,
+  const std::vector<std::string>& partNameList);
+
 VecBoundSphere
 CreateBoundingSpheres(ActFixVectorDbl points, ActFixScalarDbl searchRadius);
 
@@ -55,6 +62,26 @@ void ExecuteFineSearch(
   ActFixScalarBool isLocalPoint,
   ActFixScalarInt localParallelRedundancy);
 
+/*! \brief Fine search seeded with the result of the previous search
+ *
+ * Points that were local on the previous search are first looked up in their
+ * previous owning element and the elements sharing a node with it.  Only the
+ * points that are not found there fall back to the fine search over their
+ * coarse search candidates.  `matchElemIds` and `isLocalPoint` must hold the
+ * result of the previous search on input.  Returns the number of points that
+ * were located without the fallback.
+ */
+int ExecuteIncrementalFineSearch(
+  stk::mesh::BulkData& stkBulk,
+  const stk::mesh::Selector& searchSelector,
+  ActScalarU64Dv coarsePointIds,
+  ActScalarU64Dv coarseElemIds,
+  ActFixVectorDbl points,
+  ActFixElemIds matchElemIds,
+  ActFixVectorDbl localCoords,
+  ActFixScalarBool isLocalPoint,
+  ActFixScalarInt localParallelRedundancy);
+
 } // namespace nalu
 } // namespace sierra
 
@@ -0,0 +1,247 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef BEAMSEGMENTBINS_H
+#define BEAMSEGMENTBINS_H
+
+#include <aero/aero_utils/Pt2Line.h>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace fsi {
+
+/** Search structure for the segments of a tower or blade beam mesh
+ *
+ *  Returns the same segment as looping over every segment of the beam and
+ *  stopping at the first one for which projectPt2Line lies in [0, 1], without
+ *  visiting every segment. Query points are located by their coordinate along
+ *  the chord from the first to the last beam point. Each segment is placed in
+ *  the chord bins where its projection can lie in [0, 1] for a point within
+ *  the lateral radius given to build(). Bins list the segments in increasing
+ *  order so the first match in a bin is the first match overall.
+ *
+ *  Points farther from the chord than the build radius are searched linearly.
+ */
+class BeamSegmentBins
+{
+public:
+  /**
+   *  @param refPos Beam positions with a stride of 6 (position and
+   * orientation), as in the OpenFAST reference position arrays
+   *  @param iStart Index of the first point of this beam in refPos
+   *  @param nPts Number of points of this beam
+   */
+  BeamSegmentBins(const std::vector<double>& refPos, int iStart, int nPts)
+    : numSegments_(std::max(nPts - 1, 0)), points_(3 * std::max(nPts, 0))
+  {
+    for (int i = 0; i < nPts; ++i) {
+      for (int d = 0; d < 3; ++d) {
+        points_[3 * i + d] = refPos[(iStart + i) * 6 + d];
+      }
+    }
+    if (nPts < 2)
+      return;
+
+    double length = 0.0;
+    for (int d = 0; d < 3; ++d) {
+      chordStart_[d] = points_[d];
+      chordDir_[d] = points_[3 * (nPts - 1) + d] - points_[d];
+      length += chordDir_[d] * chordDir_[d];
+    }
+    length = std::sqrt(length);
+    if (length > 0.0) {
+      for (int d = 0; d < 3; ++d)
+        chordDir_[d] /= length;
+    }
+    length_ = length;
+  }
+
+  //! Distance of a point from the chord of the beam
+  double lateral_distance(const vs::Vector& pt) const
+  {
+    const double s = chord_coordinate(pt);
+    double dist = 0.0;
+    for (int d = 0; d < 3; ++d) {
+      const double w = pt[d] - chordStart_[d] - s * chordDir_[d];
+      dist += w * w;
+    }
+    return std::sqrt(dist);
+  }
+
+  /** Bin the segments for query points within 'radius' of the chord
+   *
+   *  @param radius Largest lateral distance of the points to be searched
+   *  @param numBins Number of chord bins, defaults to four per segment
+   */
+  void build(double radius, int numBins = 0)
+  {
+    radius_ = radius;
+    numBins_ = (numBins > 0) ? numBins : 4 * numSegments_;
+    binStart_.assign(numBins_ + 1, 0);
+    binSegments_.clear();
+    alwaysSegments_.clear();
+    if (numSegments_ == 0 || length_ == 0.0) {
+      numBins_ = 0;
+      return;
+    }
+
+    // chord interval of every segment that can contain a projection
+    const double pad = 1.0e-10 * (length_ + radius_);
+    std::vector<double> segLo(numSegments_), segHi(numSegments_);
+    std::vector<bool> bounded(numSegments_, true);
+    double lo = 0.0;
+    double hi = 0.0;
+    bool first = true;
+    for (int i = 0; i < numSegments_; ++i) {
+      const double* a = &points_[3 * i];
+      const double* b = &points_[3 * (i + 1)];
+      double dd = 0.0, k = 0.0, c = 0.0;
+      double seg[3];
+      for (int d = 0; d < 3; ++d) {
+        seg[d] = b[d] - a[d];
+        dd += seg[d] * seg[d];
+        k += chordDir_[d] * seg[d];
+        c += (chordStart_[d] - a[d]) * seg[d];
+      }
+      double perp = 0.0;
+      for (int d = 0; d < 3; ++d) {
+        const double p = seg[d] - k * chordDir_[d];
+        perp += p * p;
+      }
+      perp = std::sqrt(perp);
+
+      // segments nearly perpendicular to the chord are always candidates
+      if (std::abs(k) <= 1.0e-12 * std::sqrt(dd)) {
+        bounded[i] = false;
+        continue;
+      }
+      const double sA = (-c - radius_ * perp) / k;
+      const double sB = (dd - c + radius_ * perp) / k;
+      segLo[i] = std::min(sA, sB) - pad;
+      segHi[i] = std::max(sA, sB) + pad;
+      lo = first ? segLo[i] : std::min(lo, segLo[i]);
+      hi = first ? segHi[i] : std::max(hi, segHi[i]);
+      first = false;
+    }
+    for (int i = 0; i < numSegments_; ++i) {
+      if (!bounded[i])
+        alwaysSegments_.push_back(i);
+    }
+    if (first) {
+      numBins_ = 0;
+      return;
+    }
+
+    binLo_ = lo;
+    binWidth_ = std::max(hi - lo, pad) / numBins_;
+
+    // count, offset and fill in increasing segment order
+    for (int pass = 0; pass < 2; ++pass) {
+      std::vector<int> fill(binStart_.begin(), binStart_.end() - 1);
+      for (int i = 0; i < numSegments_; ++i) {
+        const bool isBounded = bounded[i];
+        const int bLo = isBounded ? bin_index(segLo[i]) : 0;
+        const int bHi = isBounded ? bin_index(segHi[i]) : numBins_ - 1;
+        for (int bin = bLo; bin <= bHi; ++bin) {
+          if (pass == 0)
+            ++binStart_[bin + 1];
+          else
+            binSegments_[fill[bin]++] = i;
+        }
+      }
+      if (pass == 0) {
+        for (int bin = 0; bin < numBins_; ++bin)
+          binStart_[bin + 1] += binStart_[bin];
+        binSegments_.resize(binStart_[numBins_]);
+      }
+    }
+  }
+
+  /** First segment whose projection of 'pt' lies in [0, 1]
+   *
+   *  @param pt Query point
+   *  @param nDimCoord Projection of 'pt' on the returned segment
+   *  @return Segment index within this beam, -1 if there is none
+   */
+  int find_segment(const vs::Vector& pt, double& nDimCoord) const
+  {
+    if (numBins_ == 0 || lateral_distance(pt) > radius_) {
+      for (int i = 0; i < numSegments_; ++i) {
+        if (projects_on_segment(pt, i, nDimCoord))
+          return i;
+      }
+      return -1;
+    }
+
+    const double s = chord_coordinate(pt);
+    const double x = (s - binLo_) / binWidth_;
+    if (x < 0.0 || x >= numBins_) {
+      for (const int i : alwaysSegments_) {
+        if (projects_on_segment(pt, i, nDimCoord))
+          return i;
+      }
+      return -1;
+    }
+
+    const int bin = static_cast<int>(x);
+    for (int n = binStart_[bin]; n < binStart_[bin + 1]; ++n) {
+      const int i = binSegments_[n];
+      if (projects_on_segment(pt, i, nDimCoord))
+        return i;
+    }
+    return -1;
+  }
+
+  //! Number of segments listed in the bins, for diagnostics
+  size_t num_binned_segments() const { return binSegments_.size(); }
+
+private:
+  double chord_coordinate(const vs::Vector& pt) const
+  {
+    double s = 0.0;
+    for (int d = 0; d < 3; ++d)
+      s += (pt[d] - chordStart_[d]) * chordDir_[d];
+    return s;
+  }
+
+  int bin_index(double s) const
+  {
+    const int bin = static_cast<int>(std::floor((s - binLo_) / binWidth_));
+    return std::min(std::max(bin, 0), numBins_ - 1);
+  }
+
+  bool projects_on_segment(const vs::Vector& pt, int i, double& nDim) const
+  {
+    const double* a = &points_[3 * i];
+    const vs::Vector lStart = {a[0], a[1], a[2]};
+    const vs::Vector lEnd = {a[3], a[4], a[5]};
+    nDim = projectPt2Line(pt, lStart, lEnd);
+    return (nDim >= 0) && (nDim <= 1.0);
+  }
+
+  int numSegments_{0};
+  std::vector<double> points_;
+  double chordStart_[3] = {0.0, 0.0, 0.0};
+  double chordDir_[3] = {0.0, 0.0, 0.0};
+  double length_{0.0};
+
+  double radius_{0.0};
+  int numBins_{0};
+  double binLo_{0.0};
+  double binWidth_{1.0};
+  std::vector<int> binStart_;
+  std::vector<int> binSegments_;
+  std::vector<int> alwaysSegments_;
+};
+
+} // namespace fsi
+
+#endif /* BEAMSEGMENTBINS_H */
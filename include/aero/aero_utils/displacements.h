@@ -20,15 +20,18 @@ namespace aero {
 //! WienerMilenkovic parameter
 struct SixDOF
 {
+  KOKKOS_FUNCTION
   SixDOF() : position_(vs::Vector::zero()), orientation_(vs::Vector::zero()) {}
 
   // Kind of dangerous constructor
+  KOKKOS_FUNCTION
   SixDOF(double* vec)
     : position_({vec[0], vec[1], vec[2]}),
       orientation_({vec[3], vec[4], vec[5]})
   {
   }
 
+  KOKKOS_FUNCTION
   SixDOF(vs::Vector transDisp, vs::Vector rotDisp)
     : position_(transDisp), orientation_(rotDisp)
   {
@@ -0,0 +1,109 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef CONTINUITYEDGEOPERATOR_H
+#define CONTINUITYEDGEOPERATOR_H
+
+#include "KokkosInterface.h"
+#include "LinearSolverTypes.h"
+#include "TpetraLinearSystem.h"
+
+#include "stk_mesh/base/Selector.hpp"
+#include "stk_mesh/base/Types.hpp"
+
+#include <vector>
+
+namespace sierra {
+namespace nalu {
+
+class Realm;
+
+/** Matrix-free edge Laplacian of the pressure Poisson equation
+ *
+ *  Applies the LHS of ContinuityEdgeSolverAlg with the current momentum
+ *  diagonal and density, so the interior LHS is only assembled when the
+ *  matrix is refreshed for the preconditioner. Rows that receive
+ *  contributions other than the edge Laplacian (open boundaries, fixed
+ *  pressure, ...) are detected at every refresh and are applied from the
+ *  matrix assembled for the current solve, which the other algorithms still
+ *  fill on every solve. Rows that were reset by those algorithms drop the
+ *  edge Laplacian.
+ */
+class ContinuityEdgeOperator final : public TpetraMatrixFreeOperator
+{
+public:
+  ContinuityEdgeOperator(
+    Realm& realm,
+    const stk::mesh::PartVector& parts,
+    TpetraLinearSystem& linsys);
+
+  virtual ~ContinuityEdgeOperator() = default;
+
+  void apply(
+    const LinSys::MultiVector& x,
+    LinSys::MultiVector& y,
+    Teuchos::ETransp mode = Teuchos::NO_TRANS,
+    double alpha = 1.0,
+    double beta = 0.0) const final;
+
+  Teuchos::RCP<const LinSys::Map> getDomainMap() const final
+  {
+    return ownedMap_;
+  }
+  Teuchos::RCP<const LinSys::Map> getRangeMap() const final
+  {
+    return ownedMap_;
+  }
+
+  void update(const LinSys::Matrix& matrix, bool refreshed) final;
+
+  //! Number of local rows applied from the assembled matrix
+  int num_assembled_rows() const { return numAssembledRows_; }
+
+private:
+  void compute_edge_coefficients();
+  void extract_assembled_rows(const LinSys::Matrix& matrix);
+  void copy_assembled_rows(const LinSys::Matrix& matrix);
+
+  Realm& realm_;
+  const stk::mesh::Selector selector_;
+
+  Teuchos::RCP<const LinSys::Map> ownedMap_;
+  Teuchos::RCP<const LinSys::Map> ownedAndSharedMap_;
+  Teuchos::RCP<LinSys::Import> importer_;
+  Teuchos::RCP<LinSys::Export> exporter_;
+
+  //! edge, left and right node of every locally owned edge
+  Kokkos::View<stk::mesh::FastMeshIndex* [3], MemSpace> edgeIndices_;
+  //! owned-and-shared rows of the left and right node
+  Kokkos::View<LinSys::LocalOrdinal* [2], MemSpace> edgeRows_;
+  Kokkos::View<double*, MemSpace> edgeCoeffs_;
+
+  //! 0 for rows reset by the other algorithms, 1 otherwise
+  LinSys::MultiVector edgeRowMask_;
+  std::vector<LinSys::LocalOrdinal> assembledRowIds_;
+  Teuchos::RCP<LinSys::Matrix> assembledRows_;
+  int numAssembledRows_{0};
+
+  //! complete matrix of a refresh, applied as is during that solve
+  const LinSys::Matrix* refreshedMatrix_{nullptr};
+
+  mutable LinSys::MultiVector xOwnedAndShared_;
+  mutable LinSys::MultiVector yOwnedAndShared_;
+
+  unsigned coordinates_{stk::mesh::InvalidOrdinal};
+  unsigned densityNp1_{stk::mesh::InvalidOrdinal};
+  unsigned edgeAreaVec_{stk::mesh::InvalidOrdinal};
+  unsigned Udiag_{stk::mesh::InvalidOrdinal};
+};
+
+} // namespace nalu
+} // namespace sierra
+
+#endif /* CONTINUITYEDGEOPERATOR_H */
@@ -40,7 +40,8 @@ create_tensor_product_hex_elements(
   std::vector<double> nodeLocs1D,
   stk::mesh::BulkData& bulk,
   const VectorFieldType& coordField,
-  const stk::mesh::PartVector& elemPartsToBePromoted);
+  const stk::mesh::PartVector& elemPartsToBePromoted,
+  bool threaded = false);
 
 stk::mesh::PartVector create_promoted_boundary_elements(
   int p, stk::mesh::BulkData& bulk, const stk::mesh::PartVector& meshParts);
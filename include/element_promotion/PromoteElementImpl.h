@@ -13,6 +13,7 @@
 #include <stk_mesh/base/Types.hpp>
 #include <stk_mesh/base/FieldBase.hpp>
 
+#include <array>
 #include <vector>
 #include <tuple>
 #include <unordered_map>
@@ -97,7 +98,8 @@ std::pair<stk::mesh::PartVector, stk::mesh::PartVector> promote_elements_hex(
   std::vector<double> nodeLocs1D,
   stk::mesh::BulkData& bulk,
   const VectorFieldType& coordField,
-  const stk::mesh::PartVector& elemPartsToBePromoted);
+  const stk::mesh::PartVector& elemPartsToBePromoted,
+  bool threaded = false);
 
 ConnectivityMap connectivity_map_for_parent_rank(
   stk::mesh::BulkData& bulk,
@@ -105,6 +107,27 @@ ConnectivityMap connectivity_map_for_parent_rank(
   const stk::mesh::Selector& selector,
   stk::topology::rank_t parent_rank);
 
+// Number of selected entities whose new nodes are numbered on this process:
+// owned entities and entities that are not shared
+size_t count_locally_numbered_entities(
+  const stk::mesh::BulkData& bulk,
+  const stk::mesh::Selector& selector,
+  stk::topology::rank_t parent_rank);
+
+// First new node id of this process for the edge, face and volume nodes
+std::array<stk::mesh::EntityId, 3> first_new_node_ids(
+  const stk::mesh::BulkData& bulk, const std::array<size_t, 3>& numNewNodes);
+
+// Replaces perform_parallel_consolidation_of_node_ids: locally numbered
+// entities take consecutive ids from firstNodeId and the owners send the ids
+// of shared entities to the sharing processes
+ConnectivityMap connectivity_map_for_parent_rank_scan(
+  stk::mesh::BulkData& bulk,
+  const int numNewNodesOnTopo,
+  const stk::mesh::Selector& selector,
+  stk::topology::rank_t parent_rank,
+  stk::mesh::EntityId firstNodeId);
+
 void add_base_nodes_to_elem_connectivity(
   const stk::mesh::BulkData& bulk,
   const HexNElementDescription& desc,
@@ -143,6 +166,14 @@ stk::mesh::PartVector create_super_elements(
   const ConnectivityMap& faceConnectivity,
   const ConnectivityMap& volumeConnectivity);
 
+stk::mesh::PartVector create_super_elements_threaded(
+  stk::mesh::BulkData& bulk,
+  const HexNElementDescription& desc,
+  const stk::mesh::PartVector& partsToBePromoted,
+  const ConnectivityMap& edgeConnectivity,
+  const ConnectivityMap& faceConnectivity,
+  const ConnectivityMap& volumeConnectivity);
+
 void set_coordinates_hex(
   std::vector<double> nodeLocs1D,
   const stk::mesh::BulkData& bulk,
@@ -0,0 +1,97 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef CHEBYSHEV_SMOOTHER_H
+#define CHEBYSHEV_SMOOTHER_H
+
+#include "Teuchos_BLAS_types.hpp"
+#include "Teuchos_RCP.hpp"
+#include "Tpetra_MultiVector.hpp"
+#include "Tpetra_Operator.hpp"
+
+namespace Teuchos {
+class ParameterList;
+}
+
+namespace sierra {
+namespace nalu {
+namespace matrix_free {
+
+/** Chebyshev polynomial smoother on D^{-1} A
+ *
+ *  Uses the inverse diagonal computed by the matrix-free Jacobi operators.
+ *  The largest eigenvalue of D^{-1} A is estimated with a few power
+ *  iterations when the operator changes; applying the smoother is then "degree"
+ *  operator applications with no global reductions.
+ *
+ *  Parameters, with defaults:
+ *    "Chebyshev Degree" (2), "Chebyshev Eigenvalue Ratio" (30),
+ *    "Chebyshev Eigenvalue Boost" (1.1), "Power Iterations" (10)
+ */
+class ChebyshevSmoother final : public Tpetra::Operator<>
+{
+public:
+  using mv_type = Tpetra::MultiVector<>;
+  using map_type = Tpetra::Map<>;
+  using operator_type = Tpetra::Operator<>;
+
+  ChebyshevSmoother(
+    Teuchos::RCP<const map_type> owned_map,
+    int num_vectors,
+    const Teuchos::ParameterList&);
+
+  //! "degree" iterations from a zero initial guess
+  void apply(
+    const mv_type& b,
+    mv_type& x,
+    Teuchos::ETransp trans = Teuchos::NO_TRANS,
+    double alpha = 1.0,
+    double beta = 0.0) const final;
+
+  //! the inverse diagonal has either one column, shared by all of the
+  //! vectors, or one column per vector
+  void set_operator(
+    Teuchos::RCP<const operator_type> op,
+    Teuchos::RCP<const mv_type> inv_diagonal);
+
+  //! collective: estimate the largest eigenvalue of D^{-1} A
+  void compute_eigenvalue_estimate();
+
+  void smooth(
+    int degree, bool zero_initial_guess, const mv_type& b, mv_type& x) const;
+
+  int degree() const { return degree_; }
+  double max_eigenvalue() const { return lambda_max_; }
+
+  Teuchos::RCP<const map_type> getDomainMap() const final { return map_; }
+  Teuchos::RCP<const map_type> getRangeMap() const final { return map_; }
+
+private:
+  void scale_by_inverse_diagonal(
+    double alpha, const mv_type& r, double beta, mv_type& d) const;
+
+  const Teuchos::RCP<const map_type> map_;
+  const int degree_;
+  const double eigenvalue_ratio_;
+  const double eigenvalue_boost_;
+  const int power_iterations_;
+
+  Teuchos::RCP<const operator_type> op_;
+  Teuchos::RCP<const mv_type> inv_diagonal_;
+  double lambda_max_{1};
+
+  mutable mv_type r_;
+  mutable mv_type d_;
+};
+
+} // namespace matrix_free
+} // namespace nalu
+} // namespace sierra
+
+#endif
@@ -11,6 +11,7 @@
 #define CVFEM_COEFFICIENTS_H
 
 #include "ArrayND.h"
+#include "matrix_free/LegendrePolynomials.h"
 
 // An option to use a symmetric version of
 // the P=2 CVFEM operator.  This loses one to two orders
@@ -24,9 +25,136 @@
 namespace sierra {
 namespace nalu {
 namespace matrix_free {
+namespace impl {
+
+// subcontrol volume boundaries: -1, the p Gauss-Legendre points, +1
+template <int p>
+constexpr ArrayND<double[p + 2]>
+scv_bounds()
+{
+  constexpr auto scs = legendre::gauss_nodes<p>();
+  ArrayND<double[p + 2]> b{};
+  b(0) = -1;
+  for (int i = 0; i < p; ++i) {
+    b(i + 1) = scs(i);
+  }
+  b(p + 1) = +1;
+  return b;
+}
+
+template <int p>
+constexpr ArrayND<double[p + 1][p + 1]>
+scv_integration_weights()
+{
+  constexpr auto x = legendre::lobatto_nodes<p>();
+  constexpr auto b = scv_bounds<p>();
+  constexpr auto xq = legendre::gauss_nodes<p>();
+  constexpr auto wq = legendre::gauss_weights<p>();
+  ArrayND<double[p + 1][p + 1]> w{};
+  for (int i = 0; i < p + 1; ++i) {
+    const double jac = 0.5 * (b(i + 1) - b(i));
+    const double mid = 0.5 * (b(i + 1) + b(i));
+    for (int j = 0; j < p + 1; ++j) {
+      double integral = 0;
+      for (int q = 0; q < p; ++q) {
+        const double t = jac * xq(q) + mid;
+        integral += wq(q) * jac * legendre::lagrange<p>(x, j, t);
+      }
+      w(i, j) = integral;
+    }
+  }
+  return w;
+}
+
+template <int p>
+constexpr ArrayND<double[p + 1][p + 1]>
+nodal_derivative()
+{
+  constexpr auto x = legendre::lobatto_nodes<p>();
+  ArrayND<double[p + 1][p + 1]> d{};
+  for (int i = 0; i < p + 1; ++i) {
+    for (int j = 0; j < p + 1; ++j) {
+      d(i, j) = legendre::lagrange_derivative<p>(x, j, x(i));
+    }
+  }
+  return d;
+}
+
+template <int p, bool derivative>
+constexpr ArrayND<double[p][p + 1]>
+scs_interpolant()
+{
+  constexpr auto x = legendre::lobatto_nodes<p>();
+  constexpr auto scs = legendre::gauss_nodes<p>();
+  ArrayND<double[p][p + 1]> n{};
+  for (int i = 0; i < p; ++i) {
+    for (int j = 0; j < p + 1; ++j) {
+      n(i, j) = derivative ? legendre::lagrange_derivative<p>(x, j, scs(i))
+                           : legendre::lagrange<p>(x, j, scs(i));
+    }
+  }
+  return n;
+}
+
+template <int p>
+constexpr ArrayND<double[2][p + 1]>
+linear_nodal_interpolant()
+{
+  constexpr auto x = legendre::lobatto_nodes<p>();
+  ArrayND<double[2][p + 1]> n{};
+  for (int j = 0; j < p + 1; ++j) {
+    n(0, j) = 0.5 * (1 - x(j));
+    n(1, j) = 0.5 * (1 + x(j));
+  }
+  return n;
+}
+
+template <int p>
+constexpr ArrayND<double[2][p]>
+linear_scs_interpolant()
+{
+  constexpr auto scs = legendre::gauss_nodes<p>();
+  ArrayND<double[2][p]> n{};
+  for (int i = 0; i < p; ++i) {
+    n(0, i) = 0.5 * (1 - scs(i));
+    n(1, i) = 0.5 * (1 + scs(i));
+  }
+  return n;
+}
+
+template <int p>
+constexpr ArrayND<double[p + 1]>
+scv_lengths()
+{
+  constexpr auto b = scv_bounds<p>();
+  ArrayND<double[p + 1]> l{};
+  for (int i = 0; i < p + 1; ++i) {
+    l(i) = b(i + 1) - b(i);
+  }
+  return l;
+}
+
+} // namespace impl
+
+// orders without a table below are generated at compile time from the
+// Lobatto nodes and the Gauss-Legendre subcontrol surfaces
 template <int p>
 struct Coeffs
 {
+  using nodal_matrix_type = ArrayND<double[p + 1][p + 1]>;
+  using scs_matrix_type = ArrayND<double[p][p + 1]>;
+  using linear_nodal_matrix_type = ArrayND<double[2][p + 1]>;
+  using linear_scs_matrix_type = ArrayND<double[2][p]>;
+
+  static constexpr nodal_matrix_type W = impl::scv_integration_weights<p>();
+  static constexpr nodal_matrix_type D = impl::nodal_derivative<p>();
+  static constexpr scs_matrix_type Nt = impl::scs_interpolant<p, false>();
+  static constexpr scs_matrix_type Dt = impl::scs_interpolant<p, true>();
+  static constexpr linear_nodal_matrix_type Nlin =
+    impl::linear_nodal_interpolant<p>();
+  static constexpr linear_scs_matrix_type Ntlin =
+    impl::linear_scs_interpolant<p>();
+  static constexpr ArrayND<double[p + 1]> Wl = impl::scv_lengths<p>();
 };
 
 template <>
@@ -55,6 +55,10 @@ struct InteriorResidualFields
   scalar_view<p> qp1;
   scalar_view<p> volume_metric;
   scs_vector_view<p> diffusion_metric;
+
+  // what the diffusion metric is computed from
+  scalar_view<p> lambda;
+  hex_vertex_view vertices;
 };
 
 template <int p>
@@ -62,6 +66,21 @@ struct LinearizedResidualFields
 {
   scalar_view<p> volume_metric;
   scs_vector_view<p> diffusion_metric;
+
+  //! only needed when the operator recomputes the diffusion metric; stored
+  //! alongside diffusion_metric, which the residual and preconditioners read
+  scalar_view<p> lambda;
+  hex_vertex_view vertices;
+};
+
+// nodal values the metrics are computed from, for rebuilding the metrics at
+// the coarse orders of p-multigrid
+template <int p>
+struct ConductionNodalCoefficients
+{
+  vector_view<p> coords;
+  scalar_view<p> alpha;
+  scalar_view<p> lambda;
 };
 
 namespace impl {
@@ -76,6 +95,18 @@ struct gather_required_conduction_fields_t
 } // namespace impl
 P_INVOKEABLE(gather_required_conduction_fields)
 
+namespace impl {
+
+template <int p>
+struct gather_conduction_nodal_coefficients_t
+{
+  static ConductionNodalCoefficients<p>
+  invoke(const stk::mesh::MetaData&, const_elem_mesh_index_view<p>);
+};
+
+} // namespace impl
+P_INVOKEABLE(gather_conduction_nodal_coefficients)
+
 } // namespace matrix_free
 } // namespace nalu
 } // namespace sierra
@@ -47,6 +47,9 @@ public:
   }
   BCFluxFields<p> get_flux_fields() { return flux_fields; }
 
+  //! gathered on demand, only p-multigrid needs them
+  ConductionNodalCoefficients<p> gather_nodal_coefficients();
+
 private:
   stk::mesh::BulkData& bulk;
   const stk::mesh::MetaData& meta;
@@ -59,6 +59,25 @@ struct conduction_linearized_residual_t
 };
 } // namespace impl
 P_INVOKEABLE(conduction_linearized_residual)
+namespace impl {
+//! same operator, with the diffusion metric recomputed in the kernel from
+//! the element vertices and the nodal diffusivity
+template <int p>
+struct conduction_linearized_residual_recomputed_t
+{
+  using narray = ArrayND<ftype[p + 1][p + 1][p + 1]>;
+
+  static void invoke(
+    double gamma,
+    const_elem_offset_view<p> offsets,
+    const_scalar_view<p> volume_metric,
+    const_scalar_view<p> lambda,
+    const_hex_vertex_view vertices,
+    ra_tpetra_view_type delta_owned,
+    tpetra_view_type rhs);
+};
+} // namespace impl
+P_INVOKEABLE(conduction_linearized_residual_recomputed)
 } // namespace matrix_free
 } // namespace nalu
 } // namespace sierra
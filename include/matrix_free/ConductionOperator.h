@@ -127,6 +127,11 @@ public:
     dirichlet_bc_offsets_ = dirichlet_offsets;
   }
 
+  //! recompute the diffusion metric from the vertices and lambda in every
+  //! application rather than reading the stored metric
+  void set_recompute_metric(bool recompute) { recompute_metric_ = recompute; }
+  bool recompute_metric() const { return recompute_metric_; }
+
   Teuchos::RCP<const map_type> getDomainMap() const final
   {
     return exporter_.getTargetMap();
@@ -137,6 +142,8 @@ public:
   }
 
 private:
+  void apply_interior(const mv_type& sln, mv_type& rhs) const;
+
   const const_elem_offset_view<p> elem_offsets_;
   const export_type& exporter_;
 
@@ -145,6 +152,7 @@ private:
 
   LinearizedResidualFields<p> fields_;
   double gamma_{+1};
+  bool recompute_metric_{false};
 
   mutable mv_type cached_sln_;
   mutable mv_type cached_rhs_;
@@ -0,0 +1,89 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef CONDUCTION_PMULTIGRID_H
+#define CONDUCTION_PMULTIGRID_H
+
+#include "matrix_free/ConductionFields.h"
+#include "matrix_free/ConductionJacobiPreconditioner.h"
+#include "matrix_free/ConductionOperator.h"
+#include "matrix_free/KokkosViewTypes.h"
+#include "matrix_free/PMultigridPreconditioner.h"
+#include "matrix_free/PMultigridTransfer.h"
+
+#include "Tpetra_Export.hpp"
+
+#include <memory>
+
+namespace Teuchos {
+class ParameterList;
+}
+
+namespace sierra {
+namespace nalu {
+namespace matrix_free {
+
+//! conduction operator, diagonal and transfer of one p-multigrid level and
+//! the levels coarser than it
+template <int p>
+class ConductionPMultigridLevel
+{
+public:
+  using export_type = Tpetra::Export<>;
+
+  ConductionPMultigridLevel(
+    const_elem_offset_view<p> offsets, const export_type& exporter);
+
+  //! add this level and the coarser ones to the preconditioner
+  void compute(
+    double gamma,
+    const_node_offset_view dirichlet_offsets,
+    LinearizedResidualFields<p> fields,
+    ConductionNodalCoefficients<p> nodal_coeffs,
+    PMultigridPreconditioner& pmg);
+
+private:
+  static constexpr int pc = coarse_order<p>::value;
+
+  const const_elem_offset_view<p> offsets_;
+  ConductionLinearizedResidualOperator<p> op_;
+  JacobiOperator<p> diagonal_;
+  std::unique_ptr<PMultigridTransferOperator<p>> transfer_;
+  std::unique_ptr<ConductionPMultigridLevel<pc>> coarse_;
+};
+
+template <int p>
+class ConductionPMultigrid
+{
+public:
+  using export_type = Tpetra::Export<>;
+
+  ConductionPMultigrid(
+    const_elem_offset_view<p> offsets,
+    const export_type& exporter,
+    const Teuchos::ParameterList& params);
+
+  void compute(
+    double gamma,
+    const_node_offset_view dirichlet_offsets,
+    LinearizedResidualFields<p> fields,
+    ConductionNodalCoefficients<p> nodal_coeffs);
+
+  const PMultigridPreconditioner& preconditioner() const { return pmg_; }
+
+private:
+  ConductionPMultigridLevel<p> fine_level_;
+  PMultigridPreconditioner pmg_;
+};
+
+} // namespace matrix_free
+} // namespace nalu
+} // namespace sierra
+
+#endif
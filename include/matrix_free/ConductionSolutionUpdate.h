@@ -10,8 +10,10 @@
 #ifndef CONDUCTION_SOLUTION_UPDATE_H
 #define CONDUCTION_SOLUTION_UPDATE_H
 
+#include "matrix_free/ChebyshevSmoother.h"
 #include "matrix_free/ConductionJacobiPreconditioner.h"
 #include "matrix_free/ConductionOperator.h"
+#include "matrix_free/ConductionPMultigrid.h"
 #include "matrix_free/KokkosViewTypes.h"
 #include "matrix_free/MatrixFreeSolver.h"
 
@@ -22,6 +24,8 @@
 #include "stk_mesh/base/Ngp.hpp"
 #include "stk_mesh/base/Selector.hpp"
 
+#include <memory>
+
 namespace Teuchos {
 class ParameterList;
 }
@@ -76,7 +80,15 @@ public:
   compute_delta(double gamma, LinearizedResidualFields<p>);
 
   const MatrixFreeSolver& solver() const { return linear_solver_; }
-  void compute_preconditioner(double gamma, LinearizedResidualFields<p>);
+
+  //! p-multigrid is selected with a "p-multigrid" sublist of the parameters
+  //! and needs the nodal coefficients, Chebyshev smoothing of the Jacobi
+  //! diagonal with a "chebyshev" sublist; point Jacobi otherwise
+  bool uses_multigrid() const { return static_cast<bool>(pmg_op_); }
+  void compute_preconditioner(
+    double gamma,
+    LinearizedResidualFields<p>,
+    ConductionNodalCoefficients<p> = {});
 
   double residual_norm() const;
   double final_linear_norm() const;
@@ -90,6 +102,8 @@ private:
   ConductionResidualOperator<p> resid_op_;
   ConductionLinearizedResidualOperator<p> lin_op_;
   JacobiOperator<p> prec_op_;
+  std::unique_ptr<ConductionPMultigrid<p>> pmg_op_;
+  std::unique_ptr<ChebyshevSmoother> cheby_op_;
   MatrixFreeSolver linear_solver_;
   mutable Tpetra::MultiVector<> owned_and_shared_mv_;
 };
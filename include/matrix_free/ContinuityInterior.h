@@ -54,6 +54,23 @@ struct continuity_linearized_residual_t
 };
 } // namespace impl
 P_INVOKEABLE(continuity_linearized_residual)
+
+namespace impl {
+//! same operator, with the laplacian metric recomputed in the kernel from
+//! the element vertices
+template <int p>
+struct continuity_linearized_residual_recomputed_t
+{
+  using narray = ArrayND<ftype[p + 1][p + 1][p + 1]>;
+
+  static void invoke(
+    const_elem_offset_view<p> offsets,
+    const_hex_vertex_view vertices,
+    ra_tpetra_view_type xin,
+    tpetra_view_type yout);
+};
+} // namespace impl
+P_INVOKEABLE(continuity_linearized_residual_recomputed)
 } // namespace matrix_free
 } // namespace nalu
 } // namespace sierra
@@ -85,12 +85,22 @@ public:
   }
 
   void set_metric(const_scs_vector_view<p> metric) { metric_ = metric; }
+  void set_vertices(const_hex_vertex_view vertices) { vertices_ = vertices; }
+
+  //! recompute the laplacian metric from the element vertices in the apply
+  //! instead of reading the stored metric
+  void set_recompute_metric(bool recompute) { recompute_metric_ = recompute; }
+  bool recompute_metric() const { return recompute_metric_; }
 
 private:
+  void apply_interior(const mv_type& sln, mv_type& rhs) const;
+
   const const_elem_offset_view<p> elem_offsets_;
   const export_type& exporter_;
 
   const_scs_vector_view<p> metric_;
+  const_hex_vertex_view vertices_;
+  bool recompute_metric_{false};
 
   mutable mv_type cached_sln_;
   mutable mv_type cached_rhs_;
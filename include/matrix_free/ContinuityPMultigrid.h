@@ -0,0 +1,89 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef CONTINUITY_PMULTIGRID_H
+#define CONTINUITY_PMULTIGRID_H
+
+#include "matrix_free/ConductionJacobiPreconditioner.h"
+#include "matrix_free/ContinuityOperator.h"
+#include "matrix_free/KokkosViewTypes.h"
+#include "matrix_free/PMultigridPreconditioner.h"
+#include "matrix_free/PMultigridTransfer.h"
+
+#include "Teuchos_RCP.hpp"
+#include "Tpetra_Export.hpp"
+#include "Tpetra_Operator.hpp"
+
+#include <memory>
+
+namespace Teuchos {
+class ParameterList;
+}
+
+namespace sierra {
+namespace nalu {
+namespace matrix_free {
+
+//! pressure laplacian, diagonal and transfer of one p-multigrid level and
+//! the levels coarser than it
+template <int p>
+class ContinuityPMultigridLevel
+{
+public:
+  using export_type = Tpetra::Export<>;
+
+  ContinuityPMultigridLevel(
+    const_elem_offset_view<p> offsets, const export_type& exporter);
+
+  //! add this level and the coarser ones to the preconditioner
+  void compute(
+    vector_view<p> coords,
+    scs_vector_view<p> metric,
+    PMultigridPreconditioner& pmg);
+
+private:
+  static constexpr int pc = coarse_order<p>::value;
+
+  const const_elem_offset_view<p> offsets_;
+  ContinuityLinearizedResidualOperator<p> op_;
+  JacobiOperator<p> diagonal_;
+  std::unique_ptr<PMultigridTransferOperator<p>> transfer_;
+  std::unique_ptr<ContinuityPMultigridLevel<pc>> coarse_;
+};
+
+//! p-multigrid for the pressure laplacian, with the coarse solver, e.g. AMG
+//! on the sparsified P1 matrix, applied at the P1 level
+template <int p>
+class ContinuityPMultigrid
+{
+public:
+  using export_type = Tpetra::Export<>;
+
+  ContinuityPMultigrid(
+    const_elem_offset_view<p> offsets,
+    const export_type& exporter,
+    const Teuchos::ParameterList& params);
+
+  void compute(
+    vector_view<p> coords,
+    scs_vector_view<p> metric,
+    Teuchos::RCP<const Tpetra::Operator<>> coarse_solver);
+
+  const PMultigridPreconditioner& preconditioner() const { return pmg_; }
+
+private:
+  ContinuityPMultigridLevel<p> fine_level_;
+  PMultigridPreconditioner pmg_;
+};
+
+} // namespace matrix_free
+} // namespace nalu
+} // namespace sierra
+
+#endif
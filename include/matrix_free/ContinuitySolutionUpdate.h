@@ -11,6 +11,7 @@
 #define CONTINUITY_SOLUTION_UPDATE_H
 
 #include "matrix_free/ContinuityOperator.h"
+#include "matrix_free/ContinuityPMultigrid.h"
 #include "matrix_free/KokkosViewTypes.h"
 #include "matrix_free/MatrixFreeSolver.h"
 
@@ -21,6 +22,7 @@
 #include "Tpetra_CrsMatrix_fwd.hpp"
 
 #include <iosfwd>
+#include <memory>
 
 namespace Teuchos {
 class ParameterList;
@@ -45,12 +47,23 @@ public:
 
   void compute_residual(double, const_scs_scalar_view<p> mdot);
 
-  const Tpetra::MultiVector<double>&
-  compute_delta(const_scs_vector_view<p> laplacian_metric);
+  //! the vertices are only read when the operator recomputes the metric
+  const Tpetra::MultiVector<double>& compute_delta(
+    const_scs_vector_view<p> laplacian_metric,
+    const_hex_vertex_view vertices = {});
 
   void compute_preconditioner(
     Tpetra::CrsMatrix<>& mat, Teuchos::ParameterList& params);
 
+  //! p-multigrid is selected with a "p-multigrid" sublist of the parameters;
+  //! the AMG hierarchy of the vertex matrix is its coarse solver
+  bool uses_multigrid() const { return static_cast<bool>(pmg_op_); }
+  void compute_multigrid_preconditioner(
+    Tpetra::CrsMatrix<>& vertex_mat,
+    Teuchos::ParameterList& params,
+    vector_view<p> coords,
+    scs_vector_view<p> laplacian_metric);
+
   const MatrixFreeSolver& solver() const { return linear_solver_; }
   double residual_norm() const;
   double final_linear_norm() const;
@@ -64,6 +77,7 @@ private:
   ContinuityResidualOperator<p> resid_op_;
   ContinuityLinearizedResidualOperator<p> lin_op_;
   Teuchos::RCP<Tpetra::Operator<>> prec_op_;
+  std::unique_ptr<ContinuityPMultigrid<p>> pmg_op_;
 
   MatrixFreeSolver linear_solver_;
   mutable Tpetra::MultiVector<> owned_and_shared_mv_;
@@ -0,0 +1,86 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef ELEMENT_DIFFUSION_METRIC_H
+#define ELEMENT_DIFFUSION_METRIC_H
+
+#include "matrix_free/Coefficients.h"
+#include "matrix_free/ElementSCSInterpolate.h"
+#include "matrix_free/GeometricFunctions.h"
+#include "matrix_free/HexVertexCoordinates.h"
+#include "matrix_free/KokkosViewTypes.h"
+#include "ArrayND.h"
+
+// diffusion metric of a single element recomputed inside the operator
+// kernels from the element vertices, instead of streaming the stored
+// 3 x p x (p+1)^2 x 3 metric for every operator application
+
+namespace sierra {
+namespace nalu {
+namespace matrix_free {
+
+//! metric for one direction of one element, indexed like the stored metric
+//! so that the flux kernels accept either
+template <int p>
+struct ElementDiffusionMetric
+{
+  KOKKOS_FORCEINLINE_FUNCTION const ftype&
+  operator()(int /*index*/, int /*dir*/, int l, int s, int r, int d) const
+  {
+    return values(l, s, r, d);
+  }
+
+  ArrayND<ftype[p][p + 1][p + 1][3]> values;
+};
+
+//! coefficient interpolated to the subcontrol surfaces times the geometric
+//! laplacian metric, i.e. the stored geom::diffusion_metric for one direction
+template <int p, int dir, typename BoxArray, typename CoeffArray>
+KOKKOS_FUNCTION void
+recompute_diffusion_metric(
+  const BoxArray& box,
+  const CoeffArray& coeff,
+  ElementDiffusionMetric<p>& metric)
+{
+  for (int l = 0; l < p; ++l) {
+    for (int s = 0; s < p + 1; ++s) {
+      for (int r = 0; r < p + 1; ++r) {
+        const auto lm = geom::laplacian_metric<p, dir>(box, l, s, r);
+        const auto coeff_ip = interp_scs<p, dir>(coeff, l, s, r);
+        for (int d = 0; d < 3; ++d) {
+          metric.values(l, s, r, d) = coeff_ip * lm(d);
+        }
+      }
+    }
+  }
+}
+
+//! purely geometric version, the stored laplacian metric
+template <int p, int dir, typename BoxArray>
+KOKKOS_FUNCTION void
+recompute_laplacian_metric(
+  const BoxArray& box, ElementDiffusionMetric<p>& metric)
+{
+  for (int l = 0; l < p; ++l) {
+    for (int s = 0; s < p + 1; ++s) {
+      for (int r = 0; r < p + 1; ++r) {
+        const auto lm = geom::laplacian_metric<p, dir>(box, l, s, r);
+        for (int d = 0; d < 3; ++d) {
+          metric.values(l, s, r, d) = lm(d);
+        }
+      }
+    }
+  }
+}
+
+} // namespace matrix_free
+} // namespace nalu
+} // namespace sierra
+
+#endif
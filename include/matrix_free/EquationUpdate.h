@@ -102,6 +102,8 @@ public:
     const stk::mesh::NgpField<double>& coords,
     Tpetra::CrsMatrix<>& mat,
     std::string xmlname = "milestone.xml") = 0;
+  //! continuity preconditioned with p-multigrid, AMG on the vertex matrix
+  virtual bool uses_multigrid() const = 0;
 
   virtual const LowMachPostProcess& post_processor() const = 0;
 };
@@ -110,20 +112,12 @@ template <template <int> class PhysicsUpdate, typename... Args>
 std::unique_ptr<typename PhysicsUpdate<inst::P1>::update_type>
 make_updater(int p, Args&&... args)
 {
-  switch (p) {
-  case inst::P2:
-    return std::unique_ptr<PhysicsUpdate<inst::P2>>(
-      new PhysicsUpdate<inst::P2>(std::forward<Args>(args)...));
-  case inst::P3:
-    return std::unique_ptr<PhysicsUpdate<inst::P3>>(
-      new PhysicsUpdate<inst::P3>(std::forward<Args>(args)...));
-  case inst::P4:
-    return std::unique_ptr<PhysicsUpdate<inst::P4>>(
-      new PhysicsUpdate<inst::P4>(std::forward<Args>(args)...));
-  default:
-    return std::unique_ptr<PhysicsUpdate<inst::P1>>(
-      new PhysicsUpdate<inst::P1>(std::forward<Args>(args)...));
-  }
+  using update_type = typename PhysicsUpdate<inst::P1>::update_type;
+  return dispatch_polynomial_order(p, [&](auto order) {
+    constexpr int q = decltype(order)::value;
+    return std::unique_ptr<update_type>(
+      new PhysicsUpdate<q>(std::forward<Args>(args)...));
+  });
 }
 
 inline bool
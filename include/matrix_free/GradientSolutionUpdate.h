@@ -10,6 +10,7 @@
 #ifndef GRADIENT_SOLUTION_UPDATE_H
 #define GRADIENT_SOLUTION_UPDATE_H
 
+#include "matrix_free/ChebyshevSmoother.h"
 #include "matrix_free/FilterJacobi.h"
 #include "matrix_free/GreenGaussGradientOperator.h"
 #include "matrix_free/KokkosViewTypes.h"
@@ -19,6 +20,8 @@
 #include "Tpetra_Export_fwd.hpp"
 #include "Tpetra_MultiVector.hpp"
 
+#include <memory>
+
 namespace Teuchos {
 class ParameterList;
 }
@@ -59,6 +62,7 @@ private:
   GradientResidualOperator<p> resid_op_;
   GradientLinearizedResidualOperator<p> lin_op_;
   FilterJacobiOperator<p> prec_op_;
+  std::unique_ptr<ChebyshevSmoother> cheby_op_;
 
   MatrixFreeSolver linear_solver_;
   mutable Tpetra::MultiVector<double> owned_and_shared_mv_;
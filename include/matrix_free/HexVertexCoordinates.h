@@ -56,6 +56,18 @@ hex_vertex_coordinates(int index, const ElemCoordsArray& xc)
   return box;
 }
 
+KOKKOS_FORCEINLINE_FUNCTION ArrayND<ftype[3][8]>
+hex_vertex_coordinates(int index, const const_hex_vertex_view& vertices)
+{
+  ArrayND<ftype[3][8]> box;
+  for (int d = 0; d < 3; ++d) {
+    for (int n = 0; n < 8; ++n) {
+      box(d, n) = vertices(index, d, n);
+    }
+  }
+  return box;
+}
+
 template <typename ElemCoordsArray>
 KOKKOS_FUNCTION ArrayND<ftype[3][8]>
 hex_vertex_coordinates(int n, int m, int l, const ElemCoordsArray& xc)
@@ -0,0 +1,153 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef LEGENDRE_POLYNOMIALS_H
+#define LEGENDRE_POLYNOMIALS_H
+
+#include "ArrayND.h"
+
+// compile-time Gauss-Legendre and Gauss-Lobatto-Legendre rules and the 1D
+// Lagrange basis on the Lobatto nodes, used to generate the tables of the
+// orders that are not tabulated by hand
+
+namespace sierra {
+namespace nalu {
+namespace matrix_free {
+namespace legendre {
+
+constexpr double pi = 3.14159265358979323846264338327950288;
+
+//! cosine on [0, pi], enough for the initial guesses of the root finding
+constexpr double
+cosine(double x)
+{
+  double term = 1;
+  double sum = 1;
+  for (int n = 1; n < 40; ++n) {
+    term *= -x * x / ((2 * n - 1) * (2 * n));
+    sum += term;
+  }
+  return sum;
+}
+
+struct LegendreValues
+{
+  double value;
+  double derivative;
+};
+
+//! P_n(x) and P_n'(x) from the three term recurrence
+constexpr LegendreValues
+legendre(int n, double x)
+{
+  double pm1 = 1;
+  double pn = x;
+  if (n == 0) {
+    return {1, 0};
+  }
+  for (int k = 1; k < n; ++k) {
+    const double pp1 = ((2 * k + 1) * x * pn - k * pm1) / (k + 1);
+    pm1 = pn;
+    pn = pp1;
+  }
+  return {pn, n * (pm1 - x * pn) / (1 - x * x)};
+}
+
+//! roots of P_n, in ascending order
+template <int n>
+constexpr ArrayND<double[n]>
+gauss_nodes()
+{
+  ArrayND<double[n]> x{};
+  for (int i = 0; i < n; ++i) {
+    double xi = -cosine(pi * (i + 0.75) / (n + 0.5));
+    for (int it = 0; it < 100; ++it) {
+      const auto pn = legendre(n, xi);
+      xi -= pn.value / pn.derivative;
+    }
+    x(i) = xi;
+  }
+  return x;
+}
+
+template <int n>
+constexpr ArrayND<double[n]>
+gauss_weights()
+{
+  constexpr auto x = gauss_nodes<n>();
+  ArrayND<double[n]> w{};
+  for (int i = 0; i < n; ++i) {
+    const double dp = legendre(n, x(i)).derivative;
+    w(i) = 2 / ((1 - x(i) * x(i)) * dp * dp);
+  }
+  return w;
+}
+
+//! -1, the roots of P_p', and +1, in ascending order
+template <int p>
+constexpr ArrayND<double[p + 1]>
+lobatto_nodes()
+{
+  ArrayND<double[p + 1]> x{};
+  x(0) = -1;
+  x(p) = +1;
+  for (int i = 1; i < p; ++i) {
+    double xi = -cosine(pi * i / p);
+    for (int it = 0; it < 100; ++it) {
+      // P_p'' from the Legendre equation
+      const auto pn = legendre(p, xi);
+      const double d2p =
+        (2 * xi * pn.derivative - p * (p + 1) * pn.value) / (1 - xi * xi);
+      xi -= pn.derivative / d2p;
+    }
+    x(i) = xi;
+  }
+  return x;
+}
+
+//! j-th Lagrange polynomial on the nodes x
+template <int p>
+constexpr double
+lagrange(const ArrayND<double[p + 1]>& x, int j, double t)
+{
+  double val = 1;
+  for (int m = 0; m < p + 1; ++m) {
+    if (m != j) {
+      val *= (t - x(m)) / (x(j) - x(m));
+    }
+  }
+  return val;
+}
+
+template <int p>
+constexpr double
+lagrange_derivative(const ArrayND<double[p + 1]>& x, int j, double t)
+{
+  double sum = 0;
+  for (int k = 0; k < p + 1; ++k) {
+    if (k == j) {
+      continue;
+    }
+    double val = 1 / (x(j) - x(k));
+    for (int m = 0; m < p + 1; ++m) {
+      if (m != j && m != k) {
+        val *= (t - x(m)) / (x(j) - x(m));
+      }
+    }
+    sum += val;
+  }
+  return sum;
+}
+
+} // namespace legendre
+} // namespace matrix_free
+} // namespace nalu
+} // namespace sierra
+
+#endif
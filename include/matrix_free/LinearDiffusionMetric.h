@@ -30,6 +30,17 @@ struct diffusion_metric_t
 } // namespace impl
 P_INVOKEABLE(diffusion_metric)
 
+namespace impl {
+//! the element vertices, all that is needed to recompute the metric in the
+//! operator kernels
+template <int p>
+struct hex_vertices_t
+{
+  static hex_vertex_view invoke(const_vector_view<p> coordinates);
+};
+} // namespace impl
+P_INVOKEABLE(hex_vertices)
+
 } // namespace geom
 } // namespace matrix_free
 } // namespace nalu
@@ -10,15 +10,30 @@
 #ifndef LOBATTO_QUADRATURE_RULE_H
 #define LOBATTO_QUADRATURE_RULE_H
 
+#include <utility>
 #include <vector>
 #include "Kokkos_Array.hpp"
+#include "matrix_free/LegendrePolynomials.h"
 
 namespace sierra {
 namespace nalu {
 namespace matrix_free {
+namespace impl {
+template <int p, int... ns>
+constexpr Kokkos::Array<double, p + 1>
+lobatto_node_array(std::integer_sequence<int, ns...>)
+{
+  constexpr auto x = legendre::lobatto_nodes<p>();
+  return {{x(ns)...}};
+}
+} // namespace impl
+
+// orders without a table below are computed at compile time
 template <int n>
 struct GLL
 {
+  static constexpr Kokkos::Array<double, n + 1> nodes =
+    impl::lobatto_node_array<n>(std::make_integer_sequence<int, n + 1>{});
 };
 
 template <>
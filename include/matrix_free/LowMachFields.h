@@ -46,6 +46,7 @@ struct LowMachResidualFields
   scs_vector_view<p> area_metric;
   scs_vector_view<p> diffusion_metric;
   scs_vector_view<p> laplacian_metric;
+  hex_vertex_view vertices;
 };
 
 template <int p>
@@ -56,6 +57,11 @@ struct LowMachLinearizedResidualFields
   scs_scalar_view<p> advection_metric;
   scs_vector_view<p> diffusion_metric;
   scs_vector_view<p> laplacian_metric;
+
+  //! only needed when the operators recompute the diffusion metrics; stored
+  //! alongside the metrics, which the residual and preconditioners read
+  scalar_view<p> mu;
+  hex_vertex_view vertices;
 };
 
 template <int p>
@@ -120,6 +120,7 @@ public:
     const stk::mesh::NgpField<double>& coords,
     Tpetra::CrsMatrix<>& mat,
     std::string xmlname = "milestone.xml");
+  bool uses_multigrid() const { return continuity_update_.uses_multigrid(); }
 
   const LowMachPostProcess& post_processor() const { return post_process_; }
 
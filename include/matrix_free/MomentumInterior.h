@@ -70,6 +70,27 @@ struct momentum_linearized_residual_t
 };
 } // namespace impl
 P_INVOKEABLE(momentum_linearized_residual)
+namespace impl {
+//! same operator, with the diffusion metric recomputed in the kernel from
+//! the element vertices and the nodal viscosity.  The advection metric
+//! depends on the solution and is still read
+template <int p>
+struct momentum_linearized_residual_recomputed_t
+{
+  using narray = ArrayND<ftype[p + 1][p + 1][p + 1]>;
+
+  static void invoke(
+    double proj_time_scale,
+    const_elem_offset_view<p> offsets,
+    const_scalar_view<p> vp1,
+    const_scs_scalar_view<p> mdot,
+    const_scalar_view<p> mu,
+    const_hex_vertex_view vertices,
+    ra_tpetra_view_type xin,
+    tpetra_view_type yout);
+};
+} // namespace impl
+P_INVOKEABLE(momentum_linearized_residual_recomputed)
 } // namespace matrix_free
 } // namespace nalu
 } // namespace sierra
@@ -121,6 +121,11 @@ public:
     dirichlet_bc_offsets_ = dirichlet_offsets_in;
   }
 
+  //! recompute the diffusion metric from the vertices and viscosity in every
+  //! application rather than reading the stored metric
+  void set_recompute_metric(bool recompute) { recompute_metric_ = recompute; }
+  bool recompute_metric() const { return recompute_metric_; }
+
 private:
   const const_elem_offset_view<p> elem_offsets_;
   const export_type& exporter_;
@@ -128,6 +133,7 @@ private:
 
   double gamma_0_{-1};
   LowMachLinearizedResidualFields<p> fields_;
+  bool recompute_metric_{false};
 
   bool dirichlet_bc_active_{false};
   const_node_offset_view dirichlet_bc_offsets_;
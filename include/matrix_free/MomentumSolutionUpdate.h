@@ -10,6 +10,7 @@
 #ifndef MOMENTUM_SOLUTION_UPDATE_H
 #define MOMENTUM_SOLUTION_UPDATE_H
 
+#include "matrix_free/ChebyshevSmoother.h"
 #include "matrix_free/KokkosViewTypes.h"
 #include "matrix_free/MatrixFreeSolver.h"
 #include "matrix_free/MomentumJacobi.h"
@@ -20,6 +21,8 @@
 #include "Tpetra_MultiVector.hpp"
 #include "Teuchos_RCP.hpp"
 
+#include <memory>
+
 namespace Teuchos {
 class ParameterList;
 }
@@ -72,6 +75,7 @@ private:
   MomentumResidualOperator<p> resid_op_;
   MomentumLinearizedResidualOperator<p> lin_op_;
   MomentumJacobiOperator<p> prec_op_;
+  std::unique_ptr<ChebyshevSmoother> cheby_op_;
 
   MatrixFreeSolver linear_solver_;
   mutable Tpetra::MultiVector<> owned_and_shared_mv_;
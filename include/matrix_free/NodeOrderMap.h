@@ -15,10 +15,109 @@
 namespace sierra {
 namespace nalu {
 namespace matrix_free {
+namespace impl {
 
-template <int>
+// node ordering of the promoted hex elements, HexNElementDescription, as
+// map(k, j, i).  The edge nodes are numbered in the order of the edges
+// 0-3, 8-11, 4-7 and the face nodes in the order of the faces 4, 5, 3, 1, 0, 2
+template <int p>
+constexpr ArrayND<int[p + 1][p + 1][p + 1]>
+promoted_hex_node_map()
+{
+  constexpr int n1 = p - 1;
+  ArrayND<int[p + 1][p + 1][p + 1]> map{};
+  map(0, 0, 0) = 0;
+  map(0, 0, p) = 1;
+  map(0, p, p) = 2;
+  map(0, p, 0) = 3;
+  map(p, 0, 0) = 4;
+  map(p, 0, p) = 5;
+  map(p, p, p) = 6;
+  map(p, p, 0) = 7;
+
+  int n = 8;
+  for (int face = 0; face < 2; ++face) {
+    const int l = face * p;
+    for (int i = 0; i < n1; ++i) {
+      map(l, 0, i + 1) = n + i;
+      map(l, i + 1, p) = n + n1 + i;
+      map(l, p, p - (i + 1)) = n + 2 * n1 + i;
+      map(l, p - (i + 1), 0) = n + 3 * n1 + i;
+    }
+    n += 4 * n1;
+    if (face == 0) {
+      for (int k = 0; k < n1; ++k) {
+        map(k + 1, 0, 0) = n + k;
+        map(k + 1, 0, p) = n + n1 + k;
+        map(k + 1, p, p) = n + 2 * n1 + k;
+        map(k + 1, p, 0) = n + 3 * n1 + k;
+      }
+      n += 4 * n1;
+    }
+  }
+
+  for (int b = 0; b < n1; ++b) {
+    for (int a = 0; a < n1; ++a) {
+      map(0, a + 1, b + 1) = n + a + n1 * b;
+      map(p, b + 1, a + 1) = n + n1 * n1 + a + n1 * b;
+      map(b + 1, a + 1, 0) = n + 2 * n1 * n1 + b + n1 * a;
+      map(b + 1, a + 1, p) = n + 3 * n1 * n1 + a + n1 * b;
+      map(b + 1, 0, a + 1) = n + 4 * n1 * n1 + a + n1 * b;
+      map(b + 1, p, p - (a + 1)) = n + 5 * n1 * n1 + a + n1 * b;
+    }
+  }
+  n += 6 * n1 * n1;
+
+  for (int k = 0; k < n1; ++k) {
+    for (int j = 0; j < n1; ++j) {
+      for (int i = 0; i < n1; ++i) {
+        map(k + 1, j + 1, i + 1) = n + i + n1 * (j + n1 * k);
+      }
+    }
+  }
+  return map;
+}
+
+// vertices, then the edges counterclockwise, then the interior
+template <int p>
+constexpr ArrayND<int[p + 1][p + 1]>
+promoted_quad_node_map()
+{
+  ArrayND<int[p + 1][p + 1]> map{};
+  map(0, 0) = 0;
+  map(0, p) = 1;
+  map(p, p) = 2;
+  map(p, 0) = 3;
+
+  int n = 4;
+  for (int i = 1; i < p; ++i) {
+    map(0, i) = n++;
+  }
+  for (int j = 1; j < p; ++j) {
+    map(j, p) = n++;
+  }
+  for (int i = p - 1; i > 0; --i) {
+    map(p, i) = n++;
+  }
+  for (int j = p - 1; j > 0; --j) {
+    map(j, 0) = n++;
+  }
+  for (int j = 1; j < p; ++j) {
+    for (int i = 1; i < p; ++i) {
+      map(j, i) = n++;
+    }
+  }
+  return map;
+}
+
+} // namespace impl
+
+// orders without a table below follow the generic promoted element ordering
+template <int p>
 struct StkNodeOrderMapping
 {
+  using node_map_type = ArrayND<int[p + 1][p + 1][p + 1]>;
+  static constexpr node_map_type map = impl::promoted_hex_node_map<p>();
 };
 
 template <>
@@ -81,9 +180,11 @@ struct StkNodeOrderMapping<4>
       {7, 40, 39, 38, 6}}}};
 };
 
-template <int>
+template <int p>
 struct StkFaceNodeMapping
 {
+  using node_map_type = ArrayND<int[p + 1][p + 1]>;
+  static constexpr node_map_type map = impl::promoted_quad_node_map<p>();
 };
 
 template <>
@@ -0,0 +1,111 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef PMULTIGRID_PRECONDITIONER_H
+#define PMULTIGRID_PRECONDITIONER_H
+
+#include "matrix_free/ChebyshevSmoother.h"
+
+#include "Teuchos_BLAS_types.hpp"
+#include "Teuchos_ParameterList.hpp"
+#include "Teuchos_RCP.hpp"
+#include "Tpetra_MultiVector.hpp"
+#include "Tpetra_Operator.hpp"
+
+#include <vector>
+
+namespace sierra {
+namespace nalu {
+namespace matrix_free {
+
+/** V-cycle over the polynomial order levels p, p/2, ..., 1
+ *
+ *  Each level is a matrix-free operator on the fine maps together with its
+ *  inverse diagonal and the transfer to the next coarser level.  The levels
+ *  are smoothed with a ChebyshevSmoother on D^{-1} A.  The coarsest level is
+ *  solved with the coarse solver, e.g. an AMG hierarchy on a sparsified P1
+ *  matrix, or else smoothed with more Chebyshev iterations.
+ *
+ *  Parameters, with defaults:
+ *    "Chebyshev Degree" (2), "Chebyshev Eigenvalue Ratio" (30),
+ *    "Chebyshev Eigenvalue Boost" (1.1), "Power Iterations" (10),
+ *    "Coarse Chebyshev Degree" (8)
+ */
+class PMultigridPreconditioner final : public Tpetra::Operator<>
+{
+public:
+  static constexpr int num_vectors = 1;
+  using mv_type = Tpetra::MultiVector<>;
+  using map_type = Tpetra::Map<>;
+  using operator_type = Tpetra::Operator<>;
+
+  PMultigridPreconditioner(
+    Teuchos::RCP<const map_type> owned_map, const Teuchos::ParameterList&);
+
+  void apply(
+    const mv_type& b,
+    mv_type& x,
+    Teuchos::ETransp trans = Teuchos::NO_TRANS,
+    double alpha = 1.0,
+    double beta = 0.0) const final;
+
+  void clear_levels() { levels_.clear(); }
+
+  //! add the next coarser level; the transfer to the level after it is
+  //! left null on the coarsest level
+  void add_level(
+    Teuchos::RCP<const operator_type> op,
+    Teuchos::RCP<const mv_type> inv_diagonal,
+    Teuchos::RCP<const operator_type> transfer);
+
+  void set_coarse_solver(Teuchos::RCP<const operator_type> coarse_solver)
+  {
+    coarse_solver_ = coarse_solver;
+  }
+
+  //! collective: estimate the largest eigenvalue of D^{-1} A on each level
+  void compute_eigenvalue_estimates();
+
+  int num_levels() const { return static_cast<int>(levels_.size()); }
+  double max_eigenvalue(int level) const
+  {
+    return levels_[level].smoother->max_eigenvalue();
+  }
+
+  Teuchos::RCP<const map_type> getDomainMap() const final { return map_; }
+  Teuchos::RCP<const map_type> getRangeMap() const final { return map_; }
+
+private:
+  struct Level
+  {
+    Teuchos::RCP<const operator_type> op;
+    Teuchos::RCP<const operator_type> transfer;
+    Teuchos::RCP<ChebyshevSmoother> smoother;
+
+    // right hand side and solution of the level, and the residual
+    Teuchos::RCP<mv_type> b;
+    Teuchos::RCP<mv_type> x;
+    Teuchos::RCP<mv_type> r;
+  };
+
+  void vcycle(int level, const mv_type& b, mv_type& x) const;
+
+  const Teuchos::RCP<const map_type> map_;
+  const Teuchos::ParameterList params_;
+  const int coarse_degree_;
+
+  std::vector<Level> levels_;
+  Teuchos::RCP<const operator_type> coarse_solver_;
+};
+
+} // namespace matrix_free
+} // namespace nalu
+} // namespace sierra
+
+#endif
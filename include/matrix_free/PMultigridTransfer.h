@@ -0,0 +1,182 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef PMULTIGRID_TRANSFER_H
+#define PMULTIGRID_TRANSFER_H
+
+#include "matrix_free/KokkosViewTypes.h"
+#include "matrix_free/LobattoQuadratureRule.h"
+#include "matrix_free/PolynomialOrders.h"
+
+#include "Teuchos_BLAS_types.hpp"
+#include "Teuchos_RCP.hpp"
+#include "Tpetra_Export.hpp"
+#include "Tpetra_MultiVector.hpp"
+#include "Tpetra_Operator.hpp"
+
+namespace sierra {
+namespace nalu {
+namespace matrix_free {
+
+// p-multigrid coarsens to an order whose GLL nodes are a subset of the fine
+// GLL nodes at a stride of p / coarse order, so a coarse level lives on the
+// nodes of the fine mesh and reuses the fine Tpetra maps, with the entries of
+// the other nodes left at zero.  Only the P1 nodes and, for an even p, the P2
+// nodes are nested in the GLL<p> nodes: even orders coarsen to P2, odd
+// orders directly to P1
+namespace impl {
+template <int p, int pc>
+constexpr bool
+gll_nodes_are_nested()
+{
+  if (pc < 1 || p % pc != 0) {
+    return false;
+  }
+  for (int k = 0; k < pc + 1; ++k) {
+    const double diff = GLL<p>::nodes[(p / pc) * k] - GLL<pc>::nodes[k];
+    if (diff > 1.0e-14 || diff < -1.0e-14) {
+      return false;
+    }
+  }
+  return true;
+}
+} // namespace impl
+
+template <int p>
+struct coarse_order
+{
+  static constexpr int value = (p > 2 && p % 2 == 0) ? 2 : 1;
+  static constexpr int stride = p / value;
+  static_assert(
+    stride * value == p && impl::gll_nodes_are_nested<p, value>(),
+    "coarse GLL nodes must be a subset of the fine GLL nodes");
+};
+
+using tpetra_view_type = typename Tpetra::MultiVector<>::dual_view_type::t_dev;
+using ra_tpetra_view_type =
+  typename Tpetra::MultiVector<>::dual_view_type::t_dev_const_randomread;
+
+namespace impl {
+template <int p>
+struct coarsen_offsets_t
+{
+  static elem_offset_view<coarse_order<p>::value>
+  invoke(const_elem_offset_view<p> offsets);
+};
+} // namespace impl
+P_INVOKEABLE(coarsen_offsets)
+
+namespace impl {
+template <int p>
+struct coarsen_field_t
+{
+  static scalar_view<coarse_order<p>::value> invoke(const_scalar_view<p>);
+  static vector_view<coarse_order<p>::value> invoke(const_vector_view<p>);
+};
+} // namespace impl
+P_INVOKEABLE(coarsen_field)
+
+namespace impl {
+template <int p>
+struct element_multiplicity_t
+{
+  static void
+  invoke(const_elem_offset_view<p> offsets, tpetra_view_type owned_yout);
+};
+} // namespace impl
+P_INVOKEABLE(element_multiplicity)
+
+namespace impl {
+template <int p>
+struct prolongate_t
+{
+  static void invoke(
+    const_elem_offset_view<p> offsets,
+    ra_tpetra_view_type inv_multiplicity,
+    ra_tpetra_view_type coarse_xin,
+    tpetra_view_type fine_yout);
+};
+} // namespace impl
+P_INVOKEABLE(prolongate)
+
+namespace impl {
+template <int p>
+struct restrict_residual_t
+{
+  static void invoke(
+    const_elem_offset_view<p> offsets,
+    ra_tpetra_view_type inv_multiplicity,
+    ra_tpetra_view_type fine_xin,
+    tpetra_view_type coarse_yout);
+};
+} // namespace impl
+P_INVOKEABLE(restrict_residual)
+
+void zero_rows(
+  const_node_offset_view offsets, int max_row_lid, tpetra_view_type y);
+
+/** Transfer between the order p level and its coarse order level
+ *
+ *  apply with NO_TRANS interpolates the coarse level values to the fine
+ *  nodes (prolongation) and apply with TRANS is its exact transpose
+ *  (restriction).  The Dirichlet rows are excluded from the transfer.
+ */
+template <int p>
+class PMultigridTransferOperator final : public Tpetra::Operator<>
+{
+public:
+  static constexpr int num_vectors = 1;
+  using mv_type = Tpetra::MultiVector<>;
+  using map_type = Tpetra::Map<>;
+  using export_type = Tpetra::Export<>;
+
+  PMultigridTransferOperator(
+    const_elem_offset_view<p> elem_offsets_in, const export_type& exporter);
+
+  void apply(
+    const mv_type& xin,
+    mv_type& yout,
+    Teuchos::ETransp trans = Teuchos::NO_TRANS,
+    double alpha = 1.0,
+    double beta = 0.0) const final;
+
+  void set_dirichlet_nodes(const_node_offset_view dirichlet_offsets_in)
+  {
+    dirichlet_bc_active_ = dirichlet_offsets_in.extent_int(0) > 0;
+    dirichlet_bc_offsets_ = dirichlet_offsets_in;
+  }
+
+  bool hasTransposeApply() const final { return true; }
+
+  Teuchos::RCP<const map_type> getDomainMap() const final
+  {
+    return exporter_.getTargetMap();
+  }
+  Teuchos::RCP<const map_type> getRangeMap() const final
+  {
+    return exporter_.getTargetMap();
+  }
+
+private:
+  const const_elem_offset_view<p> elem_offsets_;
+  const export_type& exporter_;
+
+  bool dirichlet_bc_active_{false};
+  const_node_offset_view dirichlet_bc_offsets_;
+
+  mv_type inv_multiplicity_;
+  mutable mv_type cached_xin_;
+  mutable mv_type cached_yout_;
+};
+
+} // namespace matrix_free
+} // namespace nalu
+} // namespace sierra
+
+#endif
@@ -12,41 +12,156 @@
 
 // tools for dealing with polynomial order templates
 
+#include <stdexcept>
+#include <string>
 #include <type_traits>
+#include <utility>
 
-#ifndef NALU_POLYNOMIAL_ORDER1
-#define NALU_POLYNOMIAL_ORDER1 1
+// the set of orders compiled into the matrix-free kernels is chosen with the
+// NALU_MATRIX_FREE_ORDERS CMake list, which defines NALU_MATRIX_FREE_P<n> for
+// each order.  Without it, orders 1-4 are compiled
+#ifndef NALU_MATRIX_FREE_ORDERS_CONFIGURED
+#define NALU_MATRIX_FREE_P1 1
+#define NALU_MATRIX_FREE_P2 1
+#define NALU_MATRIX_FREE_P3 1
+#define NALU_MATRIX_FREE_P4 1
 #endif
 
-#ifndef NALU_POLYNOMIAL_ORDER2
-#define NALU_POLYNOMIAL_ORDER2 2
+#ifndef NALU_MATRIX_FREE_P1
+#define NALU_MATRIX_FREE_P1 0
 #endif
-
-#ifndef NALU_POLYNOMIAL_ORDER3
-#define NALU_POLYNOMIAL_ORDER3 3
+#ifndef NALU_MATRIX_FREE_P2
+#define NALU_MATRIX_FREE_P2 0
+#endif
+#ifndef NALU_MATRIX_FREE_P3
+#define NALU_MATRIX_FREE_P3 0
+#endif
+#ifndef NALU_MATRIX_FREE_P4
+#define NALU_MATRIX_FREE_P4 0
+#endif
+#ifndef NALU_MATRIX_FREE_P5
+#define NALU_MATRIX_FREE_P5 0
+#endif
+#ifndef NALU_MATRIX_FREE_P6
+#define NALU_MATRIX_FREE_P6 0
+#endif
+#ifndef NALU_MATRIX_FREE_P7
+#define NALU_MATRIX_FREE_P7 0
 #endif
 
-#ifndef NALU_POLYNOMIAL_ORDER4
-#define NALU_POLYNOMIAL_ORDER4 4
+#if !NALU_MATRIX_FREE_P1
+#error "linear elements are required by the matrix-free solvers"
 #endif
 
 namespace sierra {
 namespace nalu {
 namespace matrix_free {
 namespace inst {
-enum {
-  P1 = NALU_POLYNOMIAL_ORDER1,
-  P2 = NALU_POLYNOMIAL_ORDER2,
-  P3 = NALU_POLYNOMIAL_ORDER3,
-  P4 = NALU_POLYNOMIAL_ORDER4
-};
+enum { P1 = 1, P2 = 2, P3 = 3, P4 = 4, P5 = 5, P6 = 6, P7 = 7 };
 }
 
+constexpr int max_polynomial_order = 7;
+
+constexpr bool
+polynomial_order_is_compiled(int p)
+{
+  constexpr bool compiled[max_polynomial_order + 1] = {
+    false,
+    NALU_MATRIX_FREE_P1 != 0,
+    NALU_MATRIX_FREE_P2 != 0,
+    NALU_MATRIX_FREE_P3 != 0,
+    NALU_MATRIX_FREE_P4 != 0,
+    NALU_MATRIX_FREE_P5 != 0,
+    NALU_MATRIX_FREE_P6 != 0,
+    NALU_MATRIX_FREE_P7 != 0};
+  return p > 0 && p <= max_polynomial_order && compiled[p];
+}
+
+inline std::string
+compiled_polynomial_orders()
+{
+  std::string orders;
+  for (int p = 1; p <= max_polynomial_order; ++p) {
+    if (polynomial_order_is_compiled(p)) {
+      orders += (orders.empty() ? "" : " ") + std::to_string(p);
+    }
+  }
+  return orders;
+}
+
+namespace impl {
+template <int p, typename F>
+auto
+dispatch_polynomial_order(int order, F&& f)
+  -> decltype(f(std::integral_constant<int, inst::P1>{}))
+{
+  if constexpr (p > max_polynomial_order) {
+    throw std::runtime_error(
+      "Polynomial order " + std::to_string(order) +
+      " is not compiled into the matrix-free kernels, available orders: " +
+      compiled_polynomial_orders());
+  } else {
+    if constexpr (polynomial_order_is_compiled(p)) {
+      if (order == p) {
+        return f(std::integral_constant<int, p>{});
+      }
+    }
+    return dispatch_polynomial_order<p + 1>(order, std::forward<F>(f));
+  }
+}
+} // namespace impl
+
+//! calls f with std::integral_constant<int, order> for the runtime order,
+//! throwing if that order isn't compiled.  The result type is that of P1
+template <typename F>
+auto
+dispatch_polynomial_order(int order, F&& f)
+  -> decltype(f(std::integral_constant<int, inst::P1>{}))
+{
+  return impl::dispatch_polynomial_order<inst::P1>(order, std::forward<F>(f));
+}
+
+#if NALU_MATRIX_FREE_P2
+#define NALU_INSTANTIATE_P2(type, Name) template type Name<inst::P2>;
+#else
+#define NALU_INSTANTIATE_P2(type, Name)
+#endif
+#if NALU_MATRIX_FREE_P3
+#define NALU_INSTANTIATE_P3(type, Name) template type Name<inst::P3>;
+#else
+#define NALU_INSTANTIATE_P3(type, Name)
+#endif
+#if NALU_MATRIX_FREE_P4
+#define NALU_INSTANTIATE_P4(type, Name) template type Name<inst::P4>;
+#else
+#define NALU_INSTANTIATE_P4(type, Name)
+#endif
+#if NALU_MATRIX_FREE_P5
+#define NALU_INSTANTIATE_P5(type, Name) template type Name<inst::P5>;
+#else
+#define NALU_INSTANTIATE_P5(type, Name)
+#endif
+#if NALU_MATRIX_FREE_P6
+#define NALU_INSTANTIATE_P6(type, Name) template type Name<inst::P6>;
+#else
+#define NALU_INSTANTIATE_P6(type, Name)
+#endif
+#if NALU_MATRIX_FREE_P7
+#define NALU_INSTANTIATE_P7(type, Name) template type Name<inst::P7>;
+#else
+#define NALU_INSTANTIATE_P7(type, Name)
+#endif
+
+// the static_assert takes the semicolon following the macro
 #define INSTANTIATE_TYPE(type, Name)                                           \
   template type Name<inst::P1>;                                                \
-  template type Name<inst::P2>;                                                \
-  template type Name<inst::P3>;                                                \
-  template type Name<inst::P4>
+  NALU_INSTANTIATE_P2(type, Name)                                              \
+  NALU_INSTANTIATE_P3(type, Name)                                              \
+  NALU_INSTANTIATE_P4(type, Name)                                              \
+  NALU_INSTANTIATE_P5(type, Name)                                              \
+  NALU_INSTANTIATE_P6(type, Name)                                              \
+  NALU_INSTANTIATE_P7(type, Name)                                              \
+  static_assert(true, "")
 
 #define INSTANTIATE_POLYCLASS(ClassName) INSTANTIATE_TYPE(class, ClassName)
 #define INSTANTIATE_POLYSTRUCT(ClassName) INSTANTIATE_TYPE(struct, ClassName)
@@ -62,21 +177,15 @@ enum {
   }
 
 // can't return a value dependent on template parameter
-#define SWITCH_INVOKEABLE(func)                                                    \
-  template <typename... Args>                                                      \
-  auto func(int p, Args&&... args)                                                 \
-    -> decltype(IMPLNAME(func) < inst::P1 > ::invoke(std::forward<Args>(args)...)) \
-  {                                                                                \
-    switch (p) {                                                                   \
-    case inst::P2:                                                                 \
-      return IMPLNAME(func)<inst::P2>::invoke(std::forward<Args>(args)...);        \
-    case inst::P3:                                                                 \
-      return IMPLNAME(func)<inst::P3>::invoke(std::forward<Args>(args)...);        \
-    case inst::P4:                                                                 \
-      return IMPLNAME(func)<inst::P4>::invoke(std::forward<Args>(args)...);        \
-    default:                                                                       \
-      return IMPLNAME(func)<inst::P1>::invoke(std::forward<Args>(args)...);        \
-    }                                                                              \
+#define SWITCH_INVOKEABLE(func)                                                \
+  template <typename... Args>                                                  \
+  auto func(int p, Args&&... args)                                             \
+    -> decltype(IMPLNAME(func)<inst::P1>::invoke(std::forward<Args>(args)...)) \
+  {                                                                            \
+    return dispatch_polynomial_order(p, [&](auto order) -> decltype(auto) {    \
+      return IMPLNAME(func)<decltype(order)::value>::invoke(                   \
+        std::forward<Args>(args)...);                                          \
+    });                                                                        \
   }
 
 } // namespace matrix_free
@@ -67,6 +67,23 @@ struct assemble_sparsified_edge_laplacian_t
 P_INVOKEABLE(assemble_sparsified_edge_laplacian)
 SWITCH_INVOKEABLE(assemble_sparsified_edge_laplacian)
 
+// sparsified laplacian of the P1 element formed by the element vertices, the
+// coarse level of p-multigrid.  The other rows of the high-order graph only
+// get a positive diagonal so that they decouple
+namespace impl {
+template <int p>
+struct assemble_sparsified_vertex_laplacian_t
+{
+  static void invoke(
+    const stk::mesh::NgpMesh& mesh,
+    const stk::mesh::Selector& active,
+    const stk::mesh::NgpField<double>& coords,
+    NoAuraDeviceMatrix mat);
+};
+} // namespace impl
+P_INVOKEABLE(assemble_sparsified_vertex_laplacian)
+SWITCH_INVOKEABLE(assemble_sparsified_vertex_laplacian)
+
 } // namespace matrix_free
 } // namespace nalu
 } // namespace sierra
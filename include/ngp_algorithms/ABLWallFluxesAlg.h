@@ -15,6 +15,7 @@
 #include "SimdInterface.h"
 
 #include "ngp_algorithms/WallFricVelAlgDriver.h"
+#include "wind_energy/MoninObukhov.h"
 
 #include "stk_mesh/base/Types.hpp"
 
@@ -63,6 +64,8 @@ namespace nalu {
  *           monin_obukhov_averaging_type: planar
  *           fluctuation_model: Moeng
  *           fluctuating_temperature_ref: surface
+ *           monin_obukhov_warm_start: yes
+ *           stability_table_size: 2001
  *``
  *
  *
@@ -171,6 +174,19 @@ private:
   DblType gamma_m_{16.0};
   DblType gamma_h_{16.0};
 
+  //! Start the Monin-Obukhov iterations from the friction velocity of the
+  //! previous time step
+  bool warmStart_{false};
+
+  //! Number of points of the tabulated unstable stability functions; zero
+  //! evaluates them analytically
+  int stabilityTableSize_{0};
+
+  //! Lower bound of the tabulated zeta range
+  DblType stabilityTableZetaMin_{-10.0};
+
+  abl_monin_obukhov::StabilityTable stabilityTable_;
+
   bool useShifted_{false};
 
   MasterElement* meFC_{nullptr};
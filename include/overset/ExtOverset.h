@@ -21,6 +21,7 @@ namespace sierra {
 namespace nalu {
 
 class Realm;
+class OversetManagerSTK;
 
 class ExtOverset
 {
@@ -66,8 +67,14 @@ public:
   bool is_external_overset() const { return isExtOverset_; }
 
 private:
+  //! Realm uses the native overset connectivity
+  bool is_native(const Realm* realm) const;
+
   TimeIntegrator& time_;
 
+  //! Realms with native overset connectivity; these do not go through TIOGA
+  std::vector<OversetManagerSTK*> nativeMgrVec_;
+
 #ifdef NALU_USES_TIOGA
   std::vector<tioga_nalu::TiogaSTKIface*> tgIfaceVec_;
 #endif
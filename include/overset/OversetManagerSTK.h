@@ -0,0 +1,226 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef OVERSETMANAGERSTK_H
+#define OVERSETMANAGERSTK_H
+
+#include "overset/OversetManager.h"
+#include "FieldTypeDef.h"
+
+#include <stk_mesh/base/Entity.hpp>
+#include <stk_mesh/base/Types.hpp>
+#include <stk_search/BoundingBox.hpp>
+#include <stk_search/IdentProc.hpp>
+
+#include <array>
+#include <string>
+#include <vector>
+
+namespace YAML {
+class Node;
+}
+
+namespace sierra {
+namespace nalu {
+
+struct OversetUserData;
+class MasterElement;
+
+/** Cartesian map of the region enclosed by the wall boundaries of a mesh
+ *
+ *  The bounding box of the wall nodes is divided into `n^3` cells. Cells
+ *  overlapped by a wall face are marked as wall cells, the cells reachable
+ *  from the boundary of the map without crossing a wall cell are outside, and
+ *  the remaining cells are inside the body. Only the range of cells touched
+ *  by the wall faces is exchanged between the ranks, packed as bits.
+ */
+class OversetHoleMap
+{
+public:
+  enum CellState : int { OUTSIDE = 0, WALL = 1, INSIDE = 2 };
+
+  OversetHoleMap() = default;
+
+  //! Collective: build the map from the locally owned faces of the wall parts
+  void build(
+    const stk::mesh::BulkData& bulk,
+    const stk::mesh::FieldBase& coordinates,
+    const stk::mesh::Selector& wallSelector,
+    const int numCells);
+
+  //! State of the map cell containing the point; outside of the map bounds
+  //! the point is OUTSIDE
+  CellState state(const double* xyz) const;
+
+  bool active() const { return !cells_.empty(); }
+
+private:
+  int cell_index(const int i, const int j, const int k) const
+  {
+    return (k * n_ + j) * n_ + i;
+  }
+
+  //! Mark all the cells not enclosed by wall cells as OUTSIDE
+  void flood_fill();
+
+  std::array<double, 3> lo_{{0.0, 0.0, 0.0}};
+  std::array<double, 3> dx_{{1.0, 1.0, 1.0}};
+  int n_{0};
+  std::vector<int> cells_;
+};
+
+/** Overset connectivity computed in Nalu-Wind from the STK mesh
+ *
+ *  Alternative to the TIOGA library that works directly on the mesh parts and
+ *  fields, so no copy of the mesh is needed. The input uses the same
+ *  `mesh_group` layout as TIOGA.
+ *
+ *  For each mesh group:
+ *
+ *  - Hole cutting: a node of another group is a hole if it lies inside the
+ *    region enclosed by the wall parts of this group (OversetHoleMap), or if
+ *    it lies in a wall cell of the map and has no donor.
+ *
+ *  - Donor search: a coarse search of the nodes against the bounding boxes of
+ *    the elements of the other groups, followed by MasterElement::isInElement
+ *    on the candidates, threaded with Kokkos. Donor elements are ghosted to
+ *    the rank of the receptor. The donor is the smallest candidate element
+ *    that has no hole node and no node on an overset boundary.
+ *
+ *  - Fringe determination: nodes on the overset boundary parts are mandatory
+ *    receptors; other nodes become receptors when their donor element is
+ *    smaller than their dual nodal volume, or when they are connected to a
+ *    hole element. Once the iblank is known, donors containing a hole or a
+ *    receptor are dropped: receptors that were only chosen for resolution
+ *    go back to field nodes, the others pick another donor or are orphans.
+ *
+ *  Fringe values are interpolated with the OversetInfo data of the receptors.
+ */
+class OversetManagerSTK : public OversetManager
+{
+public:
+  using SearchKey = stk::search::IdentProc<uint64_t, int>;
+  using SearchSphere = stk::search::Sphere<double>;
+  using SearchBox = stk::search::Box<double>;
+
+  OversetManagerSTK(Realm&, const OversetUserData&);
+
+  virtual ~OversetManagerSTK();
+
+  virtual void setup() override;
+
+  virtual void initialize() override;
+
+  virtual void execute(const bool isDecoupled) override;
+
+  virtual void
+  overset_update_fields(const std::vector<OversetFieldData>&) override;
+
+  virtual void overset_update_field(
+    stk::mesh::FieldBase* field,
+    const int nrows = 1,
+    const int ncols = 1,
+    const bool doFinalSyncToDevice = true) override;
+
+  //! Parts forming one overset mesh group
+  struct MeshGroup
+  {
+    std::string name;
+    stk::mesh::PartVector meshParts;
+    stk::mesh::PartVector wallParts;
+    stk::mesh::PartVector ovsetParts;
+    OversetHoleMap holeMap;
+  };
+
+  const std::vector<MeshGroup>& mesh_groups() const { return groups_; }
+
+  //! Number of locally owned receptors without a valid donor
+  size_t num_orphans() const { return numOrphans_; }
+
+private:
+  OversetManagerSTK() = delete;
+  OversetManagerSTK(const OversetManagerSTK&) = delete;
+
+  void load(const YAML::Node&);
+
+  //! Mark hole nodes and the nodes of the overset boundaries
+  void cut_holes();
+
+  //! Coarse search of the nodes against the elements of the other groups and
+  //! ghosting of the candidate donor elements
+  void coarse_search();
+
+  //! Pick the donor element of each node among its candidates
+  void fine_search();
+
+  //! Set the final iblank values and fill the OversetInfo vector
+  void determine_fringes();
+
+  //! Copy the hole and fringe lists and the iblank fields to device
+  void post_connectivity_sync();
+
+  //! Select the donor of a node among its candidate elements; only elements
+  //! whose nodes are all field nodes (iblank = 1) are accepted
+  bool select_donor(
+    const size_t i,
+    const VectorFieldType& coords,
+    const ScalarIntFieldType& iblank,
+    const ScalarFieldType& elemVol);
+
+  //! The donor of a node exists on this rank and has only field nodes
+  bool donor_is_valid(const size_t i, const ScalarIntFieldType& iblank) const;
+
+  //! Reconcile the fringe states of the shared nodes and set the iblank of
+  //! the owned, shared and overset ghosted nodes from them
+  void synchronize_fringe_states();
+
+  const OversetUserData& oversetUserData_;
+
+  std::vector<MeshGroup> groups_;
+
+  //! Owned and shared nodes of all the mesh groups
+  std::vector<stk::mesh::Entity> nodes_;
+
+  //! Mesh group index of each entry of nodes_
+  std::vector<int> nodeGroup_;
+
+  //! Node is in a wall cell of the hole map of that group (-1 if none)
+  std::vector<int> nodeWallGroup_;
+
+  //! Candidate donors, {index into nodes_, element id} sorted by node
+  std::vector<std::pair<uint64_t, stk::mesh::EntityId>> candidates_;
+
+  //! Candidate elements and master elements, with the offset of the first
+  //! candidate of each node
+  std::vector<stk::mesh::Entity> candElems_;
+  std::vector<MasterElement*> candME_;
+  std::vector<size_t> candOffsets_;
+
+  //! Receptor state of each node while the fringes are determined
+  std::vector<int> nodeState_;
+
+  //! Selected donor element, parametric distance and coordinates per node
+  std::vector<stk::mesh::Entity> donors_;
+  std::vector<double> donorBestX_;
+  std::vector<double> donorIsoParCoords_;
+
+  //! Number of cells per direction of the hole maps
+  int holeMapSize_{64};
+
+  //! Tolerance on the parametric distance accepted for a donor
+  double searchTolerance_{1.0e-6};
+
+  //! Number of receptors without a valid donor in the last update
+  size_t numOrphans_{0};
+};
+
+} // namespace nalu
+} // namespace sierra
+
+#endif /* OVERSETMANAGERSTK_H */
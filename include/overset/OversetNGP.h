@@ -38,6 +38,14 @@ struct OversetArrayType
     h_view = Kokkos::create_mirror_view(d_view);
   }
 
+  //! Reallocate only if the length changes, so that the buffers registered
+  //! with TIOGA are reused when the mesh topology is unchanged
+  void ensure_size(const std::string& label, const size_t len)
+  {
+    if (d_view.size() != len)
+      init(label, len);
+  }
+
   void sync_device() { Kokkos::deep_copy(d_view, h_view); }
 
   void sync_host() { Kokkos::deep_copy(h_view, d_view); }
@@ -144,6 +144,10 @@ public:
    *
    *  Updates to mesh connectivity information will require a call to
    *  TiogaBlock::update_connectivity() instead.
+   *
+   *  With the incremental update option, only the coordinates that changed
+   *  are written and they are not copied to device for a static block. The
+   *  node resolutions are always refreshed from the dual nodal volume.
    */
   void update_coords();
 
@@ -214,6 +218,9 @@ public:
   //! Return the block name for this mesh
   const std::string& block_name() const { return block_name_; }
 
+  //! Number of nodes moved since the previous coordinate update
+  int num_moved_nodes() const { return num_moved_nodes_; }
+
 private:
   TiogaBlock() = delete;
   TiogaBlock(const TiogaBlock&) = delete;
@@ -333,6 +340,12 @@ private:
   //! Number of overset BC nodes (in this processor)
   int num_ovsetbc_{0};
 
+  //! Number of nodes moved at the last call to update_coords
+  int num_moved_nodes_{0};
+
+  //! Flag indicating that cell_res_ holds the current element volumes
+  bool cell_res_valid_{false};
+
   //! Flag to check if we are are already initialized
   bool is_init_{true};
 
@@ -356,6 +369,12 @@ public:
   {
     return bdata_.iblank_cell_.h_view;
   }
+
+  //! Nodal resolutions sent to TIOGA
+  inline auto node_resolutions() const -> decltype(bdata_.node_res_.h_view)
+  {
+    return bdata_.node_res_.h_view;
+  }
 };
 
 } // namespace tioga_nalu
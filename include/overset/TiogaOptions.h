@@ -47,6 +47,8 @@ public:
   double cell_res_mult() const { return cellResMult_; }
   double node_res_mult() const { return nodeResMult_; }
 
+  bool incremental_update() const { return incrementalUpdate_; }
+
 private:
   double cellResMult_{1.0};
   double nodeResMult_{1.0};
@@ -77,6 +79,15 @@ private:
   //! Option to let TIOGA attempt to reduce fringes.
   bool reduceFringes_{false};
 
+  /** Update the TIOGA mesh blocks and the donor ghosting incrementally
+   *
+   *  Only the coordinates that moved are repacked, static blocks skip their
+   *  coordinate and cell resolution updates, and the donor ghosting is
+   *  changed by the elements that were added or dropped instead of being
+   *  rebuilt every time step.
+   */
+  bool incrementalUpdate_{false};
+
   //! Indicates whether the user has set the number of mandatory fringe points
   //! in the input file.
   bool hasNumFringe_{false};
@@ -12,6 +12,7 @@
 #include <vector>
 #include <memory>
 #include <array>
+#include <unordered_map>
 
 namespace YAML {
 class Node;
@@ -97,6 +98,13 @@ private:
    */
   void update_ghosting();
 
+  /** Change the existing donor ghosting by the elements added and dropped
+   *
+   *  Used with the incremental update option instead of rebuilding the
+   *  ghosting every time step.
+   */
+  void update_ghosting_incremental();
+
   /** Reset all connectivity data structures when recomputing connectivity
    */
   void reset_data_structures();
@@ -153,6 +161,13 @@ private:
   //! consistent.
   std::vector<stk::mesh::EntityId> donorIDs_;
 
+  //! Donor element of each receptor node at the previous connectivity update
+  std::unordered_map<stk::mesh::EntityId, stk::mesh::EntityId> prevDonors_;
+
+  //! Number of receptors whose donor element is the same as in the previous
+  //! connectivity update
+  size_t numReusedDonors_{0};
+
   //! Name of the coordinates field (for moving mesh simulations)
   std::string coordsName_;
 };
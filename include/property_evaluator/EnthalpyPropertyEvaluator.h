@@ -42,6 +42,12 @@ public:
 
   double execute(double* indVarList, stk::mesh::Entity node);
 
+  bool execute_batched(
+    const stk::mesh::NgpMesh& ngpMesh,
+    const stk::mesh::Selector& selector,
+    const stk::mesh::NgpField<double>* indVar,
+    stk::mesh::NgpField<double>& prop);
+
   double compute_h_rt(const double& T, const double* pt_poly);
 
   std::vector<double> refMassFraction_;
@@ -78,6 +84,12 @@ public:
 
   double execute(double* indVarList, stk::mesh::Entity node);
 
+  bool execute_batched(
+    const stk::mesh::NgpMesh& ngpMesh,
+    const stk::mesh::Selector& selector,
+    const stk::mesh::NgpField<double>* indVar,
+    stk::mesh::NgpField<double>& prop);
+
   double specificHeat_;
   double referenceTemperature_;
 };
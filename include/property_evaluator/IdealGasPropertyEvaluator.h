@@ -12,6 +12,7 @@
 
 #include <property_evaluator/PropertyEvaluator.h>
 #include <FieldTypeDef.h>
+#include <KokkosInterface.h>
 
 #include <vector>
 
@@ -41,6 +42,12 @@ public:
 
   double execute(double* indVarList, stk::mesh::Entity node);
 
+  bool execute_batched(
+    const stk::mesh::NgpMesh& ngpMesh,
+    const stk::mesh::Selector& selector,
+    const stk::mesh::NgpField<double>* indVar,
+    stk::mesh::NgpField<double>& prop);
+
   const double pRef_;
   const double R_;
   double mw_;
@@ -58,6 +65,12 @@ public:
 
   double execute(double* indVarList, stk::mesh::Entity node);
 
+  bool execute_batched(
+    const stk::mesh::NgpMesh& ngpMesh,
+    const stk::mesh::Selector& selector,
+    const stk::mesh::NgpField<double>* indVar,
+    stk::mesh::NgpField<double>& prop);
+
   double compute_mw(const double* yk);
 
   // reference quantities
@@ -70,6 +83,7 @@ public:
   // reference mw vector; size and declaration
   size_t mwVecSize_;
   std::vector<double> mwVec_;
+  Kokkos::View<double*, MemSpace> mwVecDevice_;
 };
 
 class IdealGasTPPropertyEvaluator : public PropertyEvaluator
@@ -83,6 +97,12 @@ public:
 
   double execute(double* indVarList, stk::mesh::Entity node);
 
+  bool execute_batched(
+    const stk::mesh::NgpMesh& ngpMesh,
+    const stk::mesh::Selector& selector,
+    const stk::mesh::NgpField<double>* indVar,
+    stk::mesh::NgpField<double>& prop);
+
   // reference quantities
   const double R_;
 
@@ -106,6 +126,12 @@ public:
 
   double execute(double* indVarList, stk::mesh::Entity node);
 
+  bool execute_batched(
+    const stk::mesh::NgpMesh& ngpMesh,
+    const stk::mesh::Selector& selector,
+    const stk::mesh::NgpField<double>* indVar,
+    stk::mesh::NgpField<double>& prop);
+
   double compute_mw(const double* yk);
 
   // reference quantities
@@ -119,6 +145,7 @@ public:
   // reference mw vector; size and declaration
   size_t mwVecSize_;
   std::vector<double> mwVec_;
+  Kokkos::View<double*, MemSpace> mwVecDevice_;
 };
 
 } // namespace nalu
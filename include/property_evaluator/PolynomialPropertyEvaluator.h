@@ -41,6 +41,12 @@ public:
 
   virtual double execute(double* indVarList, stk::mesh::Entity node) = 0;
 
+  // polynomial of the mixture at fixed mass fractions, sum_k Yk a_k / mw_k
+  std::vector<double> mixture_coefficients(
+    const std::vector<std::vector<double>>& polynomialCoeffs,
+    const std::vector<double>& massFraction,
+    size_t numCoeffs) const;
+
   const double universalR_;
   const size_t ykVecSize_;
   const double TlowHigh_;
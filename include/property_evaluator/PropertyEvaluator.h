@@ -11,6 +11,9 @@
 #define PropertyEvaluator_h
 
 #include <stk_mesh/base/Entity.hpp>
+#include <stk_mesh/base/Selector.hpp>
+#include "stk_mesh/base/Ngp.hpp"
+#include "stk_mesh/base/NgpField.hpp"
 
 #include <vector>
 
@@ -25,6 +28,22 @@ public:
 
   virtual double
   execute(double* indVarList, stk::mesh::Entity node = stk::mesh::Entity()) = 0;
+
+  /** Evaluate the property at all nodes of the selector in a device kernel
+   *
+   *  indVar is the independent variable (temperature) or nullptr when the
+   *  algorithm has none. Returns false when the evaluator has no device
+   *  implementation, in which case the caller loops over the nodes on host
+   *  with execute().
+   */
+  virtual bool execute_batched(
+    const stk::mesh::NgpMesh& /* ngpMesh */,
+    const stk::mesh::Selector& /* selector */,
+    const stk::mesh::NgpField<double>* /* indVar */,
+    stk::mesh::NgpField<double>& /* prop */)
+  {
+    return false;
+  }
 };
 
 } // namespace nalu
@@ -0,0 +1,69 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef PropertyEvaluatorKernels_h
+#define PropertyEvaluatorKernels_h
+
+#include <KokkosInterface.h>
+#include <ngp_utils/NgpLoopUtils.h>
+
+#include "stk_mesh/base/GetNgpField.hpp"
+#include "stk_mesh/base/Ngp.hpp"
+#include "stk_mesh/base/NgpField.hpp"
+#include <stk_math/StkMath.hpp>
+
+#include <string>
+#include <vector>
+
+namespace sierra {
+namespace nalu {
+
+using PropertyMeshIndex = nalu_ngp::NGPMeshTraits<>::MeshIndex;
+
+/** Set prop = eval(meshIndex) at all nodes of the selector
+ *
+ *  Runs over whole buckets on device and marks the property as modified on
+ *  device, so that no host copy of the property is required.
+ */
+template <typename EvalFunction>
+void
+run_property_kernel(
+  const std::string& name,
+  const stk::mesh::NgpMesh& ngpMesh,
+  const stk::mesh::Selector& selector,
+  stk::mesh::NgpField<double>& prop,
+  const EvalFunction eval)
+{
+  prop.sync_to_device();
+  auto propField = prop;
+  nalu_ngp::run_entity_algorithm(
+    name, ngpMesh, stk::topology::NODE_RANK, selector,
+    KOKKOS_LAMBDA(const PropertyMeshIndex& mi) {
+      propField.get(mi, 0) = eval(mi);
+    });
+  prop.modify_on_device();
+}
+
+//! copy of a host vector in device memory
+inline Kokkos::View<double*, MemSpace>
+property_device_view(const std::string& name, const std::vector<double>& vec)
+{
+  Kokkos::View<double*, MemSpace> view(name, vec.size());
+  auto hostView = Kokkos::create_mirror_view(view);
+  for (size_t k = 0; k < vec.size(); ++k) {
+    hostView(k) = vec[k];
+  }
+  Kokkos::deep_copy(view, hostView);
+  return view;
+}
+
+} // namespace nalu
+} // namespace sierra
+
+#endif
@@ -12,6 +12,7 @@
 
 #include <property_evaluator/PropertyEvaluator.h>
 #include <FieldTypeDef.h>
+#include <KokkosInterface.h>
 
 #include <vector>
 #include <map>
@@ -44,10 +45,19 @@ public:
 
   double execute(double* indVarList, stk::mesh::Entity node);
 
+  bool execute_batched(
+    const stk::mesh::NgpMesh& ngpMesh,
+    const stk::mesh::Selector& selector,
+    const stk::mesh::NgpField<double>* indVar,
+    stk::mesh::NgpField<double>& prop);
+
   double compute_viscosity(const double& T, const double* pt_poly);
 
   std::vector<double> refMassFraction_;
   std::vector<std::vector<double>> polynomialCoeffs_;
+
+  // reference mass fraction, muRef, TRef and SRef of each species
+  Kokkos::View<double* [4], MemSpace> coeffsDevice_;
 };
 
 class SutherlandsYkPropertyEvaluator : public PropertyEvaluator
@@ -61,6 +71,12 @@ public:
 
   virtual double execute(double* indVarList, stk::mesh::Entity node);
 
+  virtual bool execute_batched(
+    const stk::mesh::NgpMesh& ngpMesh,
+    const stk::mesh::Selector& selector,
+    const stk::mesh::NgpField<double>* indVar,
+    stk::mesh::NgpField<double>& prop);
+
   virtual double compute_viscosity(const double& T, const double* pt_poly);
 
   // field definition and extraction
@@ -69,6 +85,9 @@ public:
 
   // polynomial coeffs
   std::vector<std::vector<double>> polynomialCoeffs_;
+
+  // muRef, TRef and SRef of each species
+  Kokkos::View<double* [3], MemSpace> coeffsDevice_;
 };
 
 class SutherlandsYkTrefPropertyEvaluator : public SutherlandsYkPropertyEvaluator
@@ -83,6 +102,12 @@ public:
 
   double execute(double* indVarList, stk::mesh::Entity node);
 
+  bool execute_batched(
+    const stk::mesh::NgpMesh& ngpMesh,
+    const stk::mesh::Selector& selector,
+    const stk::mesh::NgpField<double>* indVar,
+    stk::mesh::NgpField<double>& prop);
+
   const double tRef_;
 };
 
@@ -38,6 +38,12 @@ public:
 
   double execute(double* indVarList, stk::mesh::Entity node);
 
+  bool execute_batched(
+    const stk::mesh::NgpMesh& ngpMesh,
+    const stk::mesh::Selector& selector,
+    const stk::mesh::NgpField<double>* indVar,
+    stk::mesh::NgpField<double>& prop);
+
   // reference quantities
   const double aw_;
   const double bw_;
@@ -52,6 +58,12 @@ public:
 
   double execute(double* indVarList, stk::mesh::Entity node);
 
+  bool execute_batched(
+    const stk::mesh::NgpMesh& ngpMesh,
+    const stk::mesh::Selector& selector,
+    const stk::mesh::NgpField<double>* indVar,
+    stk::mesh::NgpField<double>& prop);
+
   // reference quantities
   const double aw_;
   const double bw_;
@@ -67,6 +79,12 @@ public:
 
   double execute(double* indVarList, stk::mesh::Entity node);
 
+  bool execute_batched(
+    const stk::mesh::NgpMesh& ngpMesh,
+    const stk::mesh::Selector& selector,
+    const stk::mesh::NgpField<double>* indVar,
+    stk::mesh::NgpField<double>& prop);
+
   // reference quantities
   const double aw_;
   const double bw_;
@@ -83,6 +101,12 @@ public:
 
   double execute(double* indVarList, stk::mesh::Entity node);
 
+  bool execute_batched(
+    const stk::mesh::NgpMesh& ngpMesh,
+    const stk::mesh::Selector& selector,
+    const stk::mesh::NgpField<double>* indVar,
+    stk::mesh::NgpField<double>& prop);
+
   double compute_h(const double T);
 
   // reference quantities
@@ -103,6 +127,12 @@ public:
 
   double execute(double* indVarList, stk::mesh::Entity node);
 
+  bool execute_batched(
+    const stk::mesh::NgpMesh& ngpMesh,
+    const stk::mesh::Selector& selector,
+    const stk::mesh::NgpField<double>* indVar,
+    stk::mesh::NgpField<double>& prop);
+
   // reference quantities
   const double aw_;
   const double bw_;
@@ -0,0 +1,192 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef HALOEXCHANGE_H
+#define HALOEXCHANGE_H
+
+#include <stk_mesh/base/Entity.hpp>
+#include <stk_mesh/base/Types.hpp>
+#include <stk_topology/topology.hpp>
+
+#include <mpi.h>
+
+#include <array>
+#include <iosfwd>
+#include <map>
+#include <vector>
+
+namespace stk {
+namespace mesh {
+class FieldBase;
+}
+} // namespace stk
+
+namespace sierra {
+namespace nalu {
+
+class Realm;
+
+/** Aggregated parallel update of several fields
+ *
+ *  Algorithm drivers register the nodal (or edge) fields they have assembled
+ *  and the updates each one needs, then flush all of them at once instead of
+ *  issuing one parallel_sum/communicate_field_data/periodic/overset call per
+ *  field:
+ *
+ *  - sum: the shared-entity contributions of all the fields are packed into a
+ *    single non-blocking message per neighbor rank;
+ *  - periodic: one batched PeriodicManager::apply_constraints call per
+ *    combination of flags;
+ *  - ghosted: one copy to the shared, aura, non-conformal and overset ghosts
+ *    for all the fields;
+ *  - overset: one batched fringe interpolation.
+ *
+ *  The sums of all the fields are posted first and the shared and aura ghosts
+ *  of the fields that are not summed are updated while the messages are in
+ *  flight; the callers consume the fields right after the exchange, so no
+ *  computation is overlapped with it. Periodic fields that are only ghosted
+ *  get their shared and aura ghosts before the constraints and their
+ *  non-conformal and overset ghosts after them, as with field by field
+ *  updates; summed fields get all their ghosts once the sums and constraints
+ *  are applied. The updates operate on the host copies of the fields; the
+ *  fields are marked modified on host afterwards.
+ *
+ *  \code
+ *  auto& halo = realm.halo_exchange();
+ *  halo.add_sum(dualVolume);
+ *  halo.add_periodic(dualVolume, 1);
+ *  halo.exchange();
+ *  \endcode
+ */
+class HaloExchange
+{
+public:
+  explicit HaloExchange(Realm& realm);
+
+  ~HaloExchange();
+
+  //! Sum the contributions of the ranks sharing an entity (parallel_sum)
+  void add_sum(stk::mesh::FieldBase* field);
+
+  //! Periodic master += slaves and slaves = master, after the sums
+  void add_periodic(
+    stk::mesh::FieldBase* field,
+    const unsigned sizeOfField,
+    const bool bypassFieldCheck = true,
+    const bool addSlaves = true,
+    const bool setSlaves = true);
+
+  //! Copy owned values to the shared, aura, non-conformal and overset ghosts
+  void add_ghosted(stk::mesh::FieldBase* field);
+
+  //! Interpolate the overset fringe values, after all the other updates
+  void
+  add_overset(stk::mesh::FieldBase* field, const int nRows, const int nCols);
+
+  //! Complete all the registered updates and clear the registrations
+  void exchange()
+  {
+    begin();
+    end();
+  }
+
+  //! Field updates and communication issued since the last report
+  struct Counters
+  {
+    //! Field updates requested (one per field and kind of update)
+    size_t fieldUpdates{0};
+    //! Communication rounds issued, and issued when updating field by field
+    size_t rounds{0};
+    size_t perFieldRounds{0};
+    //! Point-to-point shared-sum messages sent, and field by field
+    size_t messages{0};
+    size_t perFieldMessages{0};
+  };
+
+  const Counters& counters() const { return counters_; }
+
+  //! Collective: print the counters accumulated over the time step on rank 0
+  //! and reset them
+  void report_step(std::ostream& out);
+
+private:
+  HaloExchange() = delete;
+  HaloExchange(const HaloExchange&) = delete;
+  HaloExchange& operator=(const HaloExchange&) = delete;
+
+  //! Shared entities of one rank, per neighbor, sorted by key so that both
+  //! sides of a message agree on the order
+  struct SharedPlan
+  {
+    size_t syncCount{0};
+    std::map<int, std::vector<stk::mesh::Entity>> entities;
+  };
+
+  const SharedPlan& shared_plan(const stk::topology::rank_t rank);
+
+  //! Post the non-blocking exchange of the shared-entity sums
+  void begin();
+
+  //! Wait for the sums and apply the remaining updates
+  void end();
+
+  void pack_sums();
+
+  void unpack_sums();
+
+  //! Copies to the shared and aura ghosts
+  void update_shared_ghosts(
+    const std::vector<const stk::mesh::FieldBase*>& fields);
+
+  //! Copies to the non-conformal and overset ghosts
+  void update_interface_ghosts(
+    const std::vector<const stk::mesh::FieldBase*>& fields);
+
+  void clear();
+
+  Realm& realm_;
+
+  //! Duplicate of the mesh communicator, so the messages cannot match those
+  //! of STK exchanges issued between begin() and end()
+  MPI_Comm comm_;
+
+  std::map<stk::topology::rank_t, SharedPlan> plans_;
+
+  std::vector<stk::mesh::FieldBase*> sumFields_;
+  std::vector<stk::mesh::FieldBase*> ghostFields_;
+
+  struct PeriodicEntry
+  {
+    stk::mesh::FieldBase* field;
+    unsigned sizeOfField;
+  };
+  //! Periodic fields by flags (bypassFieldCheck, addSlaves, setSlaves)
+  std::map<std::array<bool, 3>, std::vector<PeriodicEntry>> periodicFields_;
+
+  struct OversetEntry
+  {
+    stk::mesh::FieldBase* field;
+    int nRows;
+    int nCols;
+  };
+  std::vector<OversetEntry> oversetFields_;
+
+  //! Send and receive buffers per neighbor rank of the posted exchange
+  std::map<int, std::vector<double>> sendBuffers_;
+  std::map<int, std::vector<double>> recvBuffers_;
+  std::vector<MPI_Request> requests_;
+  bool inFlight_{false};
+
+  Counters counters_;
+};
+
+} // namespace nalu
+} // namespace sierra
+
+#endif /* HALOEXCHANGE_H */
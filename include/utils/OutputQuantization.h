@@ -0,0 +1,70 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+#ifndef OUTPUTQUANTIZATION_H_
+#define OUTPUTQUANTIZATION_H_
+
+#include <cstddef>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace YAML {
+class Node;
+}
+
+namespace stk {
+namespace mesh {
+class BulkData;
+class FieldBase;
+} // namespace mesh
+} // namespace stk
+
+namespace sierra {
+namespace nalu {
+namespace output_quantization {
+
+/** Quantization step for an absolute error bound
+ *
+ *  Returns the largest power of two not exceeding twice the tolerance.
+ *  Rounding to a multiple of a power of two is exact in binary floating point
+ *  and zeroes the low-order mantissa bits, so the values compress well with
+ *  the deflate filter of the output database while the pointwise error stays
+ *  within the tolerance.
+ */
+double quantization_step(const double tolerance);
+
+//! Round the values to the nearest multiple of the quantization step
+void quantize(double* values, const size_t numValues, const double step);
+
+//! Parse a `{field_name: absolute_tolerance}` map from the input file
+void load_tolerances(
+  const YAML::Node& node, std::map<std::string, double>& tolerances);
+
+/** Quantize the host data of a field in place before it is written out
+ *
+ *  The original values are saved in `backup` and must be put back with
+ *  restore_field once the output step is complete.
+ */
+void quantize_field(
+  const stk::mesh::BulkData& bulk,
+  const stk::mesh::FieldBase& field,
+  const double tolerance,
+  std::vector<double>& backup);
+
+//! Restore the values saved by quantize_field
+void restore_field(
+  const stk::mesh::BulkData& bulk,
+  const stk::mesh::FieldBase& field,
+  const std::vector<double>& backup);
+
+} // namespace output_quantization
+} // namespace nalu
+} // namespace sierra
+
+#endif /* OUTPUTQUANTIZATION_H_ */
@@ -0,0 +1,154 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+#ifndef PERFREGIONS_H_
+#define PERFREGIONS_H_
+
+#include <mpi.h>
+
+#include <iosfwd>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace YAML {
+class Node;
+}
+
+namespace sierra {
+namespace nalu {
+
+/** Registry of nested, named performance regions
+ *
+ *  Regions form a call tree: a region opened while another one is active is
+ *  recorded as its child. Every region is forwarded to the Kokkos Tools
+ *  profiling hooks (push/pop region). When the registry is activated from the
+ *  input file, inclusive wall-clock times and call counts are accumulated per
+ *  tree node, and an optional per-rank timeline is recorded for export in the
+ *  Chrome trace-event JSON format.
+ *
+ *  At the end of the run, report() gathers the region times of all ranks and
+ *  prints, for each region, the average, minimum and maximum time, the
+ *  imbalance ratio (max/avg), the slowest rank and a histogram of the per-rank
+ *  times.
+ */
+class PerfRegistry
+{
+public:
+  static PerfRegistry& self();
+
+  //! Process the optional top-level `performance_regions` input block
+  void load(const YAML::Node& node);
+
+  //! Enable or disable the accumulation of region timings
+  void activate(bool flag) { active_ = flag; }
+
+  bool active() const { return active_; }
+
+  void begin(const std::string& name);
+
+  void end();
+
+  //! Collective: print the per-region statistics over all ranks
+  void report(MPI_Comm comm, std::ostream& out);
+
+  //! Write the recorded timeline of this rank, if tracing is enabled
+  void write_trace(int rank) const;
+
+  //! Clear all accumulated data
+  void reset();
+
+  //! Inclusive time and call count of a region path such as "a/b/c"
+  //! (returns false if the region was never entered on this rank)
+  bool
+  region_stats(const std::string& path, double& time, int& numCalls) const;
+
+  //! Paths of all regions entered on this rank, in depth-first order
+  std::vector<std::string> region_paths() const;
+
+  //! Number of bins of the per-rank time histograms
+  int histogramBins_{10};
+
+  //! File name prefix of the trace files; empty disables tracing
+  std::string tracePrefix_;
+
+  //! Ranks recording a timeline; empty means all ranks
+  std::set<int> traceRanks_;
+
+  //! Maximum number of trace events recorded per rank
+  size_t maxTraceEvents_{1000000};
+
+private:
+  PerfRegistry();
+
+  struct Node
+  {
+    std::string name;
+    int parent{-1};
+    std::map<std::string, int> children;
+    double time{0.0};
+    int numCalls{0};
+  };
+
+  struct TraceEvent
+  {
+    int node;
+    double start;
+    double duration;
+  };
+
+  std::string path(int node) const;
+
+  void collect_paths(int node, std::vector<std::string>& paths) const;
+
+  bool tracing() const;
+
+  //! Call tree; node 0 is the root and is never timed
+  std::vector<Node> nodes_;
+
+  //! Open regions, node index and start time
+  std::vector<std::pair<int, double>> stack_;
+
+  std::vector<TraceEvent> trace_;
+
+  double startTime_{0.0};
+
+  int rank_{0};
+
+  bool active_{false};
+};
+
+/** RAII handle of a performance region
+ *
+ *  \code
+ *  {
+ *    PerfRegion region("EquationSystem::assemble");
+ *    ...
+ *  }
+ *  \endcode
+ */
+class PerfRegion
+{
+public:
+  explicit PerfRegion(const std::string& name);
+
+  ~PerfRegion();
+
+private:
+  PerfRegion(const PerfRegion&) = delete;
+  PerfRegion& operator=(const PerfRegion&) = delete;
+
+  //! Registry was active when the region was opened
+  bool timed_{false};
+};
+
+} // namespace nalu
+} // namespace sierra
+
+#endif /* PERFREGIONS_H_ */
@@ -45,6 +45,17 @@ void communicate_to_fill_recv_ghosts_to_remove(
 void keep_only_elems(
   const stk::mesh::BulkData& bulk, stk::mesh::EntityProcVec& entityProcs);
 
+/** Ask the owners of received ghosts to keep sending them
+ *
+ *  Each entry of recvGhostsToKeep is a ghosted element on this rank and the
+ *  rank that owns it. The owners append (element, this rank) to elemsToGhost
+ *  so that compute_precise_ghosting_lists does not remove the ghost.
+ */
+void communicate_recv_ghosts_to_keep(
+  const stk::mesh::BulkData& bulk,
+  const stk::mesh::EntityProcVec& recvGhostsToKeep,
+  stk::mesh::EntityProcVec& elemsToGhost);
+
 void compute_precise_ghosting_lists(
   const stk::mesh::BulkData& bulk,
   stk::mesh::EntityProcVec& elemsToGhost,
@@ -0,0 +1,188 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef ABLSPECTRA_H
+#define ABLSPECTRA_H
+
+#include "xfer/LocalVolumeSearch.h"
+
+#include <fftw3.h>
+
+#include <array>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace YAML {
+class Node;
+}
+
+namespace sierra {
+namespace nalu {
+
+class Realm;
+
+/** In-situ spectra of horizontal planes in ABL simulations
+ *
+ *  Samples velocity (and optionally temperature) on uniformly spaced
+ *  horizontal planes at user-selected heights, computes the 2D power spectrum
+ *  of the fluctuations about the plane mean, and accumulates it in time. Only
+ *  the time-averaged spectra are written to a NetCDF file: the one-sided 1D
+ *  spectra along each horizontal direction and, optionally, the full 2D
+ *  spectrum.
+ *
+ *  Each height level is assigned to one MPI rank in round-robin order. Every
+ *  rank interpolates the plane points contained in its part of the mesh, the
+ *  partial planes are reduced onto the rank owning the height, and the FFTs
+ *  are performed there, so the transform work is distributed across ranks.
+ *
+ *  Requires Nalu-Wind to be built with FFTW support.
+ */
+class ABLSpectra
+{
+public:
+  ABLSpectra(Realm&, const YAML::Node&);
+
+  ~ABLSpectra();
+
+  //! Build the sample points and the FFT plans for the owned heights
+  void initialize();
+
+  //! Sample the planes, accumulate spectra and write them if necessary
+  void execute();
+
+private:
+  ABLSpectra() = delete;
+  ABLSpectra(const ABLSpectra&) = delete;
+
+  //! Process the user inputs
+  void load(const YAML::Node&);
+
+  //! Interpolate the fields to all planes and reduce them to the owning ranks
+  void sample_planes();
+
+  //! Transform the planes of the owned heights and accumulate their spectra
+  void accumulate_spectra();
+
+  //! Prepare the NetCDF file with the necessary metadata
+  void prepare_nc_file();
+
+  //! Reduce the time-averaged spectra to the root rank and write them out
+  void write_spectra();
+
+  //! MPI rank performing the FFTs for a given height index
+  int height_owner(int ih) const { return ih % numProcs_; }
+
+  //! Reference to Realm object
+  Realm& realm_;
+
+  //! Part names where the planes are sampled
+  std::vector<std::string> partNames_;
+
+  //! Heights of the sample planes
+  std::vector<double> heights_;
+
+  //! Lower left corner of the sample planes (x, y)
+  std::array<double, 2> origin_{{0.0, 0.0}};
+
+  //! Horizontal extent of the sample planes (Lx, Ly)
+  std::array<double, 2> lengths_{{1.0, 1.0}};
+
+  //! Number of uniformly spaced sample points per plane (nx, ny)
+  std::array<int, 2> numPoints_{{32, 32}};
+
+  //! Name of the NetCDF file where spectra are output
+  std::string outputFile_{"abl_spectra.nc"};
+
+  //! Map of `{variableName : netCDF_ID}` obtained from the NetCDF C interface
+  std::unordered_map<std::string, int> ncVarIDs_;
+
+  //! Interpolated plane data for the owned heights [nOwned, nComp, ny, nx]
+  std::vector<double> planeData_;
+
+  //! Running sum of the 2D power spectra of the owned heights
+  //! [nOwned, nComp, ny, nx/2+1]
+  std::vector<double> spectraSum_;
+
+  //! Global height indices owned by this rank
+  std::vector<int> ownedHeights_;
+
+  //! Sample points of all planes, [nHeights, ny, nx]
+  std::vector<std::array<double, 3>> points_;
+
+  //! Reusable search data for the local interpolation
+  std::unique_ptr<LocalVolumeSearchData> searchData_;
+
+  //! FFTW work arrays and plan for the 2D real-to-complex transform
+  std::vector<double> fftIn_;
+  std::vector<double> fftOut_;
+  fftw_plan plan_{nullptr};
+
+  //! Number of components transformed: velocity (3) + temperature (0/1)
+  int nComp_{3};
+
+  //! Number of samples accumulated so far
+  int numSamples_{0};
+
+  //! Number of plane points not found in the mesh since the last output
+  int numMissing_{0};
+
+  //! Time step interval between samples
+  int sampleFrequency_{1};
+
+  //! Time step interval between writes of the averaged spectra
+  int outputFrequency_{100};
+
+  //! Number of records written to the NetCDF file
+  size_t outputCounter_{0};
+
+  //! Simulation time at which sampling starts
+  double startTime_{0.0};
+
+  int numProcs_{1};
+  int myRank_{0};
+
+  //! Compute spectra of the temperature field
+  bool doTemperature_{true};
+
+  //! Write the full 2D spectra in addition to the 1D spectra
+  bool output2D_{false};
+
+  //! Flag indicating whether initialization must be performed
+  bool doInit_{true};
+};
+
+namespace spectra {
+
+/** Fold a 2D power spectrum into one-sided 1D spectra along x and y
+ *
+ *  @param[in] nx Number of points along x
+ *  @param[in] ny Number of points along y
+ *  @param[in] p2d Power spectrum from a real-to-complex transform stored as
+ *  [ny, nx/2+1]
+ *  @param[out] ex One-sided spectrum along x, [nx/2+1]
+ *  @param[out] ey One-sided spectrum along y, [ny/2+1]
+ *
+ *  The spectra are normalized such that their sums equal the sum of the 2D
+ *  power spectrum over the full (two-sided) wavenumber plane.
+ */
+void fold_power_spectrum(
+  int nx,
+  int ny,
+  const double* p2d,
+  std::vector<double>& ex,
+  std::vector<double>& ey);
+
+} // namespace spectra
+
+} // namespace nalu
+} // namespace sierra
+
+#endif /* ABLSPECTRA_H */
@@ -13,6 +13,8 @@
 #include "KokkosInterface.h"
 #include "SimdInterface.h"
 
+#include <stk_util/util/ReportHandler.hpp>
+
 namespace sierra {
 namespace nalu {
 namespace abl_monin_obukhov {
@@ -63,6 +65,259 @@ psih_unstable(const T& zeta, const T gamma = 16.0)
   return (2.0 * stk::math::log(0.5 * (1.0 + phih)));
 }
 
+/** Momentum stability function for either sign of zeta
+ *
+ *  The stable or unstable branch is selected per lane by `stable`; the
+ *  argument of the branch that is not selected is clamped so that it stays
+ *  finite.
+ */
+template <typename T, typename Mask>
+KOKKOS_FORCEINLINE_FUNCTION T
+psim(const T& zeta, const Mask& stable, const T& beta, const T& gamma)
+{
+  return stk::math::if_then_else(
+    stable, psim_stable(stk::math::max(zeta, 0.0), beta),
+    psim_unstable(stk::math::min(zeta, 0.0), gamma));
+}
+
+//! Heat stability function for either sign of zeta, see psim
+template <typename T, typename Mask>
+KOKKOS_FORCEINLINE_FUNCTION T
+psih(const T& zeta, const Mask& stable, const T& beta, const T& gamma)
+{
+  return stk::math::if_then_else(
+    stable, psih_stable(stk::math::max(zeta, 0.0), beta),
+    psih_unstable(stk::math::min(zeta, 0.0), gamma));
+}
+
+/** Unstable stability functions tabulated on a uniform grid of zeta
+ *
+ *  psim_unstable and psih_unstable need pow, log and atan evaluations; the
+ *  table replaces them by a linear interpolation on [zetaMin, 0]. Values of
+ *  zeta below zetaMin fall back to the analytic functions. A default
+ *  constructed table is inactive.
+ */
+class StabilityTable
+{
+public:
+  using ViewType = Kokkos::View<double*, MemSpace>;
+
+  StabilityTable() = default;
+
+  StabilityTable(
+    const int numPoints,
+    const double zetaMin,
+    const double gamma_m,
+    const double gamma_h)
+    : numPoints_(numPoints),
+      zetaMin_(zetaMin),
+      invDzeta_((numPoints - 1) / -zetaMin),
+      gamma_m_(gamma_m),
+      gamma_h_(gamma_h)
+  {
+    STK_ThrowRequireMsg(
+      numPoints > 1 && zetaMin < 0.0,
+      "StabilityTable: needs at least two points and a negative zetaMin");
+    psim_ = ViewType("psim_table", numPoints);
+    psih_ = ViewType("psih_table", numPoints);
+    auto hPsim = Kokkos::create_mirror_view(psim_);
+    auto hPsih = Kokkos::create_mirror_view(psih_);
+    for (int i = 0; i < numPoints; ++i) {
+      const double zeta = zetaMin * (1.0 - static_cast<double>(i) /
+                                             (numPoints - 1));
+      hPsim(i) = psim_unstable<double>(zeta, gamma_m);
+      hPsih(i) = psih_unstable<double>(zeta, gamma_h);
+    }
+    Kokkos::deep_copy(psim_, hPsim);
+    Kokkos::deep_copy(psih_, hPsih);
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION bool active() const { return numPoints_ > 1; }
+
+  KOKKOS_FUNCTION DoubleType psim(const DoubleType& zeta) const
+  {
+    return interpolate(psim_, zeta, gamma_m_, true);
+  }
+
+  KOKKOS_FUNCTION DoubleType psih(const DoubleType& zeta) const
+  {
+    return interpolate(psih_, zeta, gamma_h_, false);
+  }
+
+private:
+  KOKKOS_FUNCTION DoubleType interpolate(
+    const ViewType& table,
+    const DoubleType& zeta,
+    const double gamma,
+    const bool momentum) const
+  {
+    DoubleType result = 0.0;
+    for (int si = 0; si < simdLen; ++si) {
+      const double z = stk::math::min(stk::simd::get_data(zeta, si), 0.0);
+      double value;
+      if (z < zetaMin_) {
+        value = momentum ? psim_unstable<double>(z, gamma)
+                         : psih_unstable<double>(z, gamma);
+      } else {
+        const double x = (z - zetaMin_) * invDzeta_;
+        const int i = static_cast<int>(x);
+        const int i0 = (i < numPoints_ - 1) ? i : numPoints_ - 2;
+        const double w = x - i0;
+        value = (1.0 - w) * table(i0) + w * table(i0 + 1);
+      }
+      stk::simd::set_data(result, si, value);
+    }
+    return result;
+  }
+
+  ViewType psim_;
+  ViewType psih_;
+  int numPoints_{0};
+  double zetaMin_{0.0};
+  double invDzeta_{0.0};
+  double gamma_m_{16.0};
+  double gamma_h_{16.0};
+};
+
+//! Constants of the Monin-Obukhov similarity laws and of their solver
+struct WallModelParameters
+{
+  double kappa{0.41};
+  double z0{0.001};
+  double gravity{9.81};
+  double Tref{300.0};
+  double beta_m{5.0};
+  double beta_h{5.0};
+  double gamma_m{16.0};
+  double gamma_h{16.0};
+  double tol{1.0e-6};
+  int maxIters{1000};
+};
+
+/** Solve the Monin-Obukhov similarity laws for a SIMD group of wall points
+ *
+ *  Batched form of algorithm 1 (given surface temperature flux, computes the
+ *  surface temperature) and algorithm 2 (given surface temperature, computes
+ *  the flux) of Basu et al. (2008). Every lane runs the fixed-point update
+ *  until its own change drops below `tol`; converged and neutral lanes are
+ *  masked out, so the group iterates only as long as its slowest lane and
+ *  the per-lane results are those of the scalar iteration.
+ *
+ *  Lanes with a positive `utauGuess`, e.g. the friction velocity of the
+ *  previous time step, start from the stability corrections of that guess
+ *  instead of from neutral conditions.
+ *
+ *  \return the number of iterations of the slowest lane
+ */
+KOKKOS_INLINE_FUNCTION int
+compute_fluxes(
+  const WallModelParameters& p,
+  const StabilityTable& table,
+  const int algorithmType,
+  const DoubleType& up,
+  const DoubleType& Tp,
+  const DoubleType& zp,
+  const DoubleType& utauGuess,
+  DoubleType& frictionVelocity,
+  DoubleType& temperatureFlux,
+  DoubleType& Tsurface)
+{
+  const double eps = 1.0e-8;
+  const DoubleType kappa = p.kappa;
+  const DoubleType beta_m = p.beta_m;
+  const DoubleType beta_h = p.beta_h;
+  const DoubleType gamma_m = p.gamma_m;
+  const DoubleType gamma_h = p.gamma_h;
+  const DoubleType logz = stk::math::log(zp / p.z0);
+
+  // stratification is fixed by the sign of the given flux or temperature
+  // difference; negative flux means stable conditions
+  const DoubleType sgn =
+    (algorithmType == 1) ? temperatureFlux : Tsurface - Tp;
+  const stk::simd::Bool stable = sgn < -eps;
+  const stk::simd::Bool unstable = sgn > eps;
+
+  auto stability = [&](const DoubleType& u, const DoubleType& q,
+                       DoubleType& Psi_m, DoubleType& Psi_h) {
+    const DoubleType L = stk::math::if_then_else(
+      q == 0.0, 1.0e10, -(p.Tref * u * u * u) / (p.kappa * p.gravity * q));
+    const DoubleType zeta = zp / L;
+    if (table.active()) {
+      const DoubleType zetaS = stk::math::max(zeta, 0.0);
+      Psi_m = stk::math::if_then_else(
+        stable, psim_stable(zetaS, beta_m), table.psim(zeta));
+      Psi_h = stk::math::if_then_else(
+        stable, psih_stable(zetaS, beta_h), table.psih(zeta));
+    } else if (!stk::simd::are_any(unstable)) {
+      Psi_m = psim_stable(stk::math::max(zeta, 0.0), beta_m);
+      Psi_h = psih_stable(stk::math::max(zeta, 0.0), beta_h);
+    } else {
+      Psi_m = psim(zeta, stable, beta_m, gamma_m);
+      Psi_h = psih(zeta, stable, beta_h, gamma_h);
+    }
+  };
+
+  DoubleType Psi_m = 0.0;
+  DoubleType Psi_h = 0.0;
+  frictionVelocity = 0.0;
+  if (algorithmType == 2)
+    temperatureFlux = 0.0;
+
+  const stk::simd::Bool warm = (utauGuess > eps) && (stable || unstable);
+  if (stk::simd::are_any(warm)) {
+    const DoubleType q0 =
+      (algorithmType == 1) ? temperatureFlux
+                           : -((Tp - Tsurface) * utauGuess * kappa) / logz;
+    DoubleType Psi_m0, Psi_h0;
+    stability(utauGuess, q0, Psi_m0, Psi_h0);
+    Psi_m = stk::math::if_then_else(warm, Psi_m0, 0.0);
+    Psi_h = stk::math::if_then_else(warm, Psi_h0, 0.0);
+    frictionVelocity = stk::math::if_then_else(warm, utauGuess, 0.0);
+    temperatureFlux = stk::math::if_then_else(warm, q0, temperatureFlux);
+  }
+
+  stk::simd::Bool active = stable || unstable;
+  int iter = 0;
+  while (stk::simd::are_any(active) && iter < p.maxIters) {
+    const DoubleType uOld = frictionVelocity;
+    const DoubleType qOld = temperatureFlux;
+
+    const DoubleType u = (kappa * up) / (logz - Psi_m);
+    const DoubleType q =
+      (algorithmType == 2) ? -((Tp - Tsurface) * u * kappa) / (logz - Psi_m)
+                           : qOld;
+
+    DoubleType Psi_mNew, Psi_hNew;
+    stability(u, q, Psi_mNew, Psi_hNew);
+
+    frictionVelocity = stk::math::if_then_else(active, u, uOld);
+    temperatureFlux = stk::math::if_then_else(active, q, qOld);
+    Psi_m = stk::math::if_then_else(active, Psi_mNew, Psi_m);
+    Psi_h = stk::math::if_then_else(active, Psi_hNew, Psi_h);
+
+    if (algorithmType == 1) {
+      const DoubleType Ts =
+        Tp + (q * ((logz - Psi_h) / (stk::math::max(u, 0.001) * kappa)));
+      Tsurface = stk::math::if_then_else(active, Ts, Tsurface);
+    }
+
+    active = active && ((stk::math::abs(u - uOld) > p.tol) ||
+                        (stk::math::abs(q - qOld) > p.tol));
+    iter++;
+  }
+
+  // neutral conditions follow the log law
+  const stk::simd::Bool neutral = !(stable || unstable);
+  frictionVelocity =
+    stk::math::if_then_else(neutral, kappa * up / logz, frictionVelocity);
+  if (algorithmType == 1)
+    Tsurface = stk::math::if_then_else(neutral, Tp, Tsurface);
+  else
+    temperatureFlux = stk::math::if_then_else(neutral, 0.0, temperatureFlux);
+
+  return iter;
+}
+
 } // namespace abl_monin_obukhov
 } // namespace nalu
 } // namespace sierra
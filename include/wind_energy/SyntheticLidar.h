@@ -45,12 +45,14 @@ public:
     const stk::mesh::BulkData& bulk,
     const stk::mesh::Selector& active,
     const std::string& coordinates_name,
+    std::size_t coordinates_version,
     double dtratio);
 
   void output_cone_filtered(
     const stk::mesh::BulkData& bulk,
     const stk::mesh::Selector& active,
     const std::string& coordinates_name,
+    std::size_t coordinates_version,
     double dtratio);
 
 private:
@@ -97,6 +99,7 @@ private:
   double scanTime_{2};
   int nsamples_{984};
   int npoints_{100};
+  int cached_samples_{0};
   std::vector<std::string> fromTargetNames_;
 
   std::string name_{"lidar-los"};
@@ -133,6 +136,7 @@ public:
     const stk::mesh::BulkData& bulk,
     const stk::mesh::Selector& sel,
     const std::string& coords_name,
+    std::size_t coordinates_version,
     double dt,
     double time);
 
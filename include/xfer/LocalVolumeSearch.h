@@ -12,10 +12,13 @@
 
 #include "stk_mesh/base/Field.hpp"
 
+#include "stk_mesh/base/Entity.hpp"
 #include "stk_search/BoundingBox.hpp"
-#include "stk_search/IdentProc.hpp"
 
 #include <array>
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
 #include <vector>
 
 namespace stk {
@@ -29,6 +32,15 @@ namespace sierra {
 namespace nalu {
 
 // reusable allocation assuming fixed mesh graph/fixed number of points
+//
+// The element bounding boxes and the bounding volume hierarchy built over them
+// persist between calls and are only rebuilt when the mesh is modified or the
+// caller bumps coordinates_version after moving the coordinates.  With
+// max_cached_points > 0, point locations are also cached, keyed by the point
+// coordinates, so that repeating sample patterns (e.g., periodic lidar scans)
+// skip the search and interpolation reduces to a gather.  Callers size the
+// cache to one period of their pattern; points beyond it are searched every
+// time.  The cache is cleared whenever the hierarchy is rebuilt.
 struct LocalVolumeSearchData
 {
   LocalVolumeSearchData(
@@ -36,16 +48,64 @@ struct LocalVolumeSearchData
     const stk::mesh::Selector& sel,
     int npoints);
 
-  using sphere_t = stk::search::Sphere<double>;
   using box_t = stk::search::Box<double>;
-  using ident_t = stk::search::IdentProc<stk::mesh::EntityId, int>;
+  using point_key_t = std::array<std::int64_t, 3>;
+
+  struct BVHNode
+  {
+    box_t box;
+    int left{-1};
+    int right{-1};
+    int begin{0};
+    int end{0};
+  };
+
+  struct CachedPoint
+  {
+    std::array<double, 3> point;
+    stk::mesh::Entity elem;
+    std::array<double, 3> local_coords;
+    double dist;
+  };
+
+  struct PointKeyHash
+  {
+    std::size_t operator()(const point_key_t& key) const
+    {
+      std::size_t h = 0;
+      for (const auto k : key) {
+        h ^= std::hash<std::int64_t>()(k) + 0x9e3779b97f4a7c15ULL + (h << 6) +
+             (h >> 2);
+      }
+      return h;
+    }
+  };
+
+  std::vector<box_t> search_boxes;
+  std::vector<stk::mesh::Entity> box_elems;
+  std::vector<BVHNode> bvh_nodes;
+  std::vector<int> bvh_order;
+  double tolerance{0};
+  bool bvh_valid{false};
+  std::size_t bvh_sync_count{0};
+  std::size_t bvh_coordinates_version{0};
+
+  // changed by the caller whenever the coordinates have moved
+  std::size_t coordinates_version{0};
+
+  std::unordered_map<point_key_t, CachedPoint, PointKeyHash> point_cache;
+  std::size_t max_cached_points{0};
+
+  // diagnostics
+  int bvh_rebuilds{0};
+  std::size_t cache_hits{0};
+  std::size_t cache_misses{0};
 
-  std::vector<std::pair<sphere_t, ident_t>> search_points;
-  std::vector<std::pair<box_t, ident_t>> search_boxes;
-  std::vector<std::pair<ident_t, ident_t>> search_matches;
   std::vector<std::array<double, 3>> interpolated_values;
   std::vector<double> dist;
   std::vector<int> ownership;
+  std::vector<stk::mesh::Entity> owning_elems;
+  std::vector<std::array<double, 3>> local_coords;
 };
 
 // interpolate to a collection of points locally
@@ -61,6 +121,15 @@ void local_field_interpolation(
   double dtratio,
   LocalVolumeSearchData& data);
 
+// interpolate a field with an arbitrary number of components to the points
+// located by the last call to local_field_interpolation.  values are stored
+// point-major, [npoints x ncomp], and are zero for points not owned locally
+void interpolate_from_last_search(
+  const stk::mesh::BulkData& bulk,
+  const stk::mesh::Field<double>& field,
+  const LocalVolumeSearchData& data,
+  std::vector<double>& values);
+
 } // namespace nalu
 } // namespace sierra
 
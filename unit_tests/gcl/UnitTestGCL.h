@@ -18,6 +18,7 @@
 #include "ngp_algorithms/GeometryBoundaryAlg.h"
 #include "ngp_algorithms/WallFuncGeometryAlg.h"
 #include "ngp_algorithms/GeometryAlgDriver.h"
+#include "gcl/GeometryMeshVelocityEdgeAlg.h"
 #include "gcl/MeshVelocityAlg.h"
 #include "gcl/MeshVelocityEdgeAlg.h"
 #include "utils/StkHelpers.h"
@@ -133,7 +134,8 @@ public:
       timeInt.compute_gamma();
   }
 
-  void register_algorithms(const std::string& motion_options)
+  void
+  register_algorithms(const std::string& motion_options, bool fused = false)
   {
     // Force mesh motion logic everywhere
     realm_.solutionOptions_->meshMotion_ = true;
@@ -141,19 +143,31 @@ public:
     realm_.meshMotionAlg_.reset(
       new sierra::nalu::MeshMotionAlg(bulk_, motionNode["mesh_motion"]));
 
-    geomAlgDriver_.register_elem_algorithm<sierra::nalu::GeometryInteriorAlg>(
-      sierra::nalu::INTERIOR, partVec_[0], "geometry");
-    if (realm_.realmUsesEdges_) {
-      geomAlgDriver_.register_elem_algorithm<sierra::nalu::MeshVelocityEdgeAlg>(
+    register_geometry_algorithms(geomAlgDriver_, fused);
+  }
+
+  void register_geometry_algorithms(
+    sierra::nalu::GeometryAlgDriver& geomAlgDriver, bool fused)
+  {
+    if (fused && realm_.realmUsesEdges_) {
+      geomAlgDriver.register_elem_algorithm<
+        sierra::nalu::GeometryMeshVelocityEdgeAlg>(
+        sierra::nalu::INTERIOR, partVec_[0], "geometry_mesh_vel");
+    } else if (realm_.realmUsesEdges_) {
+      geomAlgDriver.register_elem_algorithm<sierra::nalu::GeometryInteriorAlg>(
+        sierra::nalu::INTERIOR, partVec_[0], "geometry");
+      geomAlgDriver.register_elem_algorithm<sierra::nalu::MeshVelocityEdgeAlg>(
         sierra::nalu::INTERIOR, partVec_[0], "mesh_vel");
     } else {
-      geomAlgDriver_.register_elem_algorithm<sierra::nalu::MeshVelocityAlg>(
+      geomAlgDriver.register_elem_algorithm<sierra::nalu::GeometryInteriorAlg>(
+        sierra::nalu::INTERIOR, partVec_[0], "geometry");
+      geomAlgDriver.register_elem_algorithm<sierra::nalu::MeshVelocityAlg>(
         sierra::nalu::INTERIOR, partVec_[0], "mesh_vel");
     }
 
     auto* part = meta_.get_part("surface_1");
     for (auto* surfPart : part->subsets()) {
-      geomAlgDriver_.register_face_algorithm<sierra::nalu::GeometryBoundaryAlg>(
+      geomAlgDriver.register_face_algorithm<sierra::nalu::GeometryBoundaryAlg>(
         sierra::nalu::BOUNDARY, surfPart, "geometry");
     }
   }